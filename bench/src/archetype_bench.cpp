@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+#include "bench_components.h"
+
+
+namespace
+{
+    using rst::bench::component;
+    using rst::ecs::entity_type;
+
+
+    struct marker_tag { };
+
+
+    constexpr std::size_t entity_count{ 100'000U };
+
+    // entities changing shape per frame in bm_frame, 1%
+    constexpr std::size_t changes_per_frame{ entity_count / 100U };
+
+
+    // +--------------------------------+
+    // | FIXTURE HELPERS                |
+    // +--------------------------------+
+    /**
+     * Every entity gets component<0> to component<component_count - 1>, built one emplace at a time like gameplay
+     * code would. The same code runs on registry and archetype_registry.
+     */
+    template <typename TRegistry, std::size_t... ids>
+    auto populate( TRegistry& registry, std::index_sequence<ids...> ) -> std::vector<entity_type>
+    {
+        std::vector<entity_type> entities( entity_count );
+        for ( entity_type& entity : entities )
+        {
+            entity = registry.entity_alloc( ).create( );
+            ( registry.template emplace<component<ids>>( entity ), ... );
+        }
+        return entities;
+    }
+
+
+    // +--------------------------------+
+    // | ITERATION                      |
+    // +--------------------------------+
+    /**
+     * Heavy iteration, no structural change: one pass over every entity and all of its components.
+     */
+    template <typename TRegistry, std::size_t component_count>
+    auto bm_iterate( benchmark::State& state ) -> void
+    {
+        TRegistry registry{};
+
+        [&]<std::size_t... ids>( std::index_sequence<ids...> )
+        {
+            populate( registry, std::index_sequence<ids...>{ } );
+            auto view = registry.template view<component<ids>...>( );
+            for ( [[maybe_unused]] auto _ : state )
+            {
+                view.each( []( component<ids>&... components ) { ( ( components.value += 1.f ), ... ); } );
+                benchmark::ClobberMemory( );
+            }
+        }( std::make_index_sequence<component_count>{ } );
+
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+
+
+    /**
+     * A frame: 1% of the entities gain or lose a tag, then one pass over every entity. The structural change is
+     * rare, the iteration dominates.
+     */
+    template <typename TRegistry, std::size_t component_count>
+    auto bm_frame( benchmark::State& state ) -> void
+    {
+        TRegistry registry{};
+
+        [&]<std::size_t... ids>( std::index_sequence<ids...> )
+        {
+            std::vector<entity_type> const entities = populate( registry, std::index_sequence<ids...>{ } );
+
+            std::size_t cursor{ 0U };
+            bool marking{ true };
+            for ( [[maybe_unused]] auto _ : state )
+            {
+                for ( std::size_t change = 0U; change < changes_per_frame; ++change )
+                {
+                    entity_type const entity = entities[cursor];
+                    if ( marking ) { registry.template emplace<marker_tag>( entity ); }
+                    else { registry.template remove<marker_tag>( entity ); }
+
+                    if ( ++cursor == entities.size( ) )
+                    {
+                        cursor  = 0U;
+                        marking = not marking;
+                    }
+                }
+
+                registry.template view<component<ids>...>( ).each(
+                    []( component<ids>&... components ) { ( ( components.value += 1.f ), ... ); } );
+                benchmark::ClobberMemory( );
+            }
+        }( std::make_index_sequence<component_count>{ } );
+
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+}
+
+
+BENCHMARK_TEMPLATE( bm_iterate, rst::ecs::registry, 3 );
+BENCHMARK_TEMPLATE( bm_iterate, rst::ecs::archetype_registry, 3 );
+BENCHMARK_TEMPLATE( bm_iterate, rst::ecs::registry, 6 );
+BENCHMARK_TEMPLATE( bm_iterate, rst::ecs::archetype_registry, 6 );
+
+BENCHMARK_TEMPLATE( bm_frame, rst::ecs::registry, 3 );
+BENCHMARK_TEMPLATE( bm_frame, rst::ecs::archetype_registry, 3 );
+BENCHMARK_TEMPLATE( bm_frame, rst::ecs::registry, 6 );
+BENCHMARK_TEMPLATE( bm_frame, rst::ecs::archetype_registry, 6 );
@@ -0,0 +1,20 @@
+#ifndef RST_BENCH_COMPONENTS_H
+#define RST_BENCH_COMPONENTS_H
+
+#include <cstddef>
+
+
+namespace rst::bench
+{
+    /**
+     * A family of distinct trivially copyable component types, one per id, for benches that need several pools.
+     */
+    template <std::size_t id>
+    struct component
+    {
+        float value{ 1.f };
+    };
+}
+
+
+#endif //!RST_BENCH_COMPONENTS_H
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+#include "bench_components.h"
+
+
+namespace
+{
+    using rst::bench::component;
+    using rst::ecs::entity_type;
+
+
+    constexpr std::size_t entity_count{ 50'000U };
+    constexpr std::size_t spawn_count{ 10'000U };
+
+
+    struct bullet_transform
+    {
+        float x{ 0.f };
+        float y{ 0.f };
+        float rotation{ 0.f };
+    };
+
+
+    struct bullet_velocity
+    {
+        float dx{ 0.f };
+        float dy{ 0.f };
+    };
+
+
+    /**
+     * Creates pool_count pools (one placeholder entity owning every component type), then entity_count entities
+     * owning two components each, spread over the pools.
+     */
+    template <std::size_t... ids>
+    auto populate( rst::ecs::registry& registry, std::index_sequence<ids...> ) -> std::vector<entity_type>
+    {
+        constexpr std::size_t pool_count{ sizeof...( ids ) };
+
+        entity_type const placeholder = registry.entity_alloc( ).create( );
+        ( registry.emplace<component<ids>>( placeholder ), ... );
+
+        // type-erased emplace per pool, to pick the pools at runtime
+        using emplace_fn = auto ( * )( rst::ecs::registry&, entity_type ) -> void;
+        constexpr std::array<emplace_fn, pool_count> emplacers{
+            +[]( rst::ecs::registry& reg, entity_type const entity ) -> void { reg.emplace<component<ids>>( entity ); }...
+        };
+
+        std::vector<entity_type> entities( entity_count );
+        for ( std::size_t i = 0U; i < entity_count; ++i )
+        {
+            entities[i] = registry.entity_alloc( ).create( );
+            emplacers[i % pool_count]( registry, entities[i] );
+            emplacers[( i * 7U + 1U ) % pool_count]( registry, entities[i] );
+        }
+        return entities;
+    }
+
+
+    // +--------------------------------+
+    // | DESTROY                        |
+    // +--------------------------------+
+    template <std::size_t pool_count>
+    auto bm_entity_destroy( benchmark::State& state ) -> void
+    {
+        // registry construction and destruction are not part of the measure
+        std::optional<rst::ecs::registry> registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            registry.reset( );
+            registry.emplace( );
+            auto const entities = populate( *registry, std::make_index_sequence<pool_count>{ } );
+            state.ResumeTiming( );
+
+            for ( entity_type const entity : entities )
+            {
+                registry->entity_alloc( ).destroy( entity );
+            }
+            benchmark::DoNotOptimize( registry->entity_alloc( ).alive_count( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+
+
+    // +--------------------------------+
+    // | DESTROY (BULK)                 |
+    // +--------------------------------+
+    template <std::size_t pool_count>
+    auto bm_entity_destroy_bulk( benchmark::State& state ) -> void
+    {
+        std::optional<rst::ecs::registry> registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            registry.reset( );
+            registry.emplace( );
+            auto const entities = populate( *registry, std::make_index_sequence<pool_count>{ } );
+            state.ResumeTiming( );
+
+            registry->entity_alloc( ).destroy( entities );
+            benchmark::DoNotOptimize( registry->entity_alloc( ).alive_count( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+
+
+    // +--------------------------------+
+    // | SPAWN (PER ENTITY)             |
+    // +--------------------------------+
+    auto bm_entity_spawn( benchmark::State& state ) -> void
+    {
+        std::optional<rst::ecs::registry> registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            registry.reset( );
+            registry.emplace( );
+            state.ResumeTiming( );
+
+            for ( std::size_t i = 0U; i < spawn_count; ++i )
+            {
+                entity_type const bullet = registry->entity_alloc( ).create( );
+                registry->emplace<bullet_transform>( bullet, 0.f, 0.f, static_cast<float>( i ) );
+                registry->emplace<bullet_velocity>( bullet, 1.f, 0.f );
+            }
+            benchmark::DoNotOptimize( registry->entity_alloc( ).alive_count( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( spawn_count ) );
+    }
+
+
+    // +--------------------------------+
+    // | SPAWN (BULK)                   |
+    // +--------------------------------+
+    auto bm_entity_spawn_bulk( benchmark::State& state ) -> void
+    {
+        std::optional<rst::ecs::registry> registry{};
+        std::vector<bullet_transform> transforms( spawn_count );
+        for ( std::size_t i = 0U; i < spawn_count; ++i ) { transforms[i].rotation = static_cast<float>( i ); }
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            registry.reset( );
+            registry.emplace( );
+            state.ResumeTiming( );
+
+            std::span<entity_type const> const bullets = registry->entity_alloc( ).create( spawn_count );
+            registry->emplace_n<bullet_transform>( bullets, transforms );
+            registry->emplace_n<bullet_velocity>( bullets, bullet_velocity{ 1.f, 0.f } );
+            benchmark::DoNotOptimize( registry->entity_alloc( ).alive_count( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( spawn_count ) );
+    }
+}
+
+
+// number of component pools in the registry, every entity owns two of them
+BENCHMARK_TEMPLATE( bm_entity_destroy, 8 );
+BENCHMARK_TEMPLATE( bm_entity_destroy, 32 );
+BENCHMARK_TEMPLATE( bm_entity_destroy, 80 );
+
+BENCHMARK_TEMPLATE( bm_entity_destroy_bulk, 8 );
+BENCHMARK_TEMPLATE( bm_entity_destroy_bulk, 32 );
+BENCHMARK_TEMPLATE( bm_entity_destroy_bulk, 80 );
+
+BENCHMARK( bm_entity_spawn );
+BENCHMARK( bm_entity_spawn_bulk );
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+#include <random>
+
+
+namespace
+{
+    using rst::ecs::entity_type;
+
+
+    struct position
+    {
+        float x{ 0.f };
+        float y{ 0.f };
+    };
+
+
+    struct velocity
+    {
+        float dx{ 1.f };
+        float dy{ 1.f };
+    };
+
+
+    // +--------------------------------+
+    // | FIXTURE HELPERS                |
+    // +--------------------------------+
+    /**
+     * Every entity gets a position, `overlap_percent` of them (picked at random, in random order) also get a velocity,
+     * so the two pools are not in the same packed order.
+     */
+    auto populate( rst::ecs::registry& registry, std::size_t const count, std::size_t const overlap_percent ) -> void
+    {
+        std::vector<entity_type> entities( count );
+        for ( entity_type& entity : entities )
+        {
+            entity = registry.entity_alloc( ).create( );
+            registry.emplace<position>( entity );
+        }
+
+        std::ranges::shuffle( entities, std::mt19937{ 0xB0A7U } );
+        for ( std::size_t i = 0U; i < count * overlap_percent / 100U; ++i )
+        {
+            registry.emplace<velocity>( entities[i] );
+        }
+    }
+
+
+    auto integrate( position& pos, velocity const& vel ) noexcept -> void
+    {
+        pos.x += vel.dx;
+        pos.y += vel.dy;
+    }
+
+
+    // +--------------------------------+
+    // | VIEW                           |
+    // +--------------------------------+
+    auto bm_view_each( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry, static_cast<std::size_t>( state.range( 0 ) ), static_cast<std::size_t>( state.range( 1 ) ) );
+
+        auto view = registry.view<position, velocity>( );
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            view.each( []( position& pos, velocity& vel ) { integrate( pos, vel ); } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) * state.range( 1 ) / 100 );
+    }
+
+
+    // +--------------------------------+
+    // | GROUP                          |
+    // +--------------------------------+
+    auto bm_group_each( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry, static_cast<std::size_t>( state.range( 0 ) ), static_cast<std::size_t>( state.range( 1 ) ) );
+
+        auto group = registry.group<position, velocity>( );
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            group.each( []( position& pos, velocity& vel ) { integrate( pos, vel ); } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( group.size( ) ) );
+    }
+
+
+    auto bm_group_each_chunk( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry, static_cast<std::size_t>( state.range( 0 ) ), static_cast<std::size_t>( state.range( 1 ) ) );
+
+        auto group = registry.group<position, velocity>( );
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            group.each_chunk(
+                []( std::span<position> positions, std::span<velocity> velocities )
+                {
+                    for ( std::size_t i = 0U; i < positions.size( ); ++i )
+                    {
+                        integrate( positions[i], velocities[i] );
+                    }
+                } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( group.size( ) ) );
+    }
+}
+
+
+// entity count x percentage of entities owning both components
+#define RST_GROUP_ARGS ArgsProduct( { { 10'000, 100'000, 1'000'000 }, { 10, 50, 90 } } )
+
+BENCHMARK( bm_view_each )->RST_GROUP_ARGS;
+BENCHMARK( bm_group_each )->RST_GROUP_ARGS;
+BENCHMARK( bm_group_each_chunk )->RST_GROUP_ARGS;
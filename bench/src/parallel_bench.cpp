@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+#include <rst/data_type/worker_pool.h>
+
+
+namespace
+{
+    using rst::ecs::entity_type;
+
+
+    // a transform heavy enough that the update is not purely memory bound
+    struct transform
+    {
+        std::array<float, 9U> world{ 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f };
+        float x{ 0.f };
+        float y{ 0.f };
+        float rotation{ 0.f };
+    };
+
+
+    struct velocity
+    {
+        float dx{ 1.f };
+        float dy{ 0.5f };
+        float angular{ 0.01f };
+    };
+
+
+    constexpr std::size_t entity_count{ 1'000'000U };
+
+
+    auto populate( rst::ecs::registry& registry ) -> void
+    {
+        for ( std::size_t i = 0U; i < entity_count; ++i )
+        {
+            entity_type const entity = registry.entity_alloc( ).create( );
+            registry.emplace<transform>( entity );
+            registry.emplace<velocity>( entity );
+        }
+    }
+
+
+    auto integrate( transform& tf, velocity const& vel ) noexcept -> void
+    {
+        tf.x += vel.dx;
+        tf.y += vel.dy;
+        tf.rotation += vel.angular;
+
+        float const cos = std::cos( tf.rotation );
+        float const sin = std::sin( tf.rotation );
+        tf.world = { cos, sin, 0.f, -sin, cos, 0.f, tf.x, tf.y, 1.f };
+    }
+
+
+    // +--------------------------------+
+    // | SERIAL                         |
+    // +--------------------------------+
+    auto bm_view_each_transform( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry );
+
+        auto view = registry.view<transform, velocity const>( );
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            view.each( []( transform& tf, velocity const& vel ) { integrate( tf, vel ); } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+
+
+    // +--------------------------------+
+    // | PARALLEL                       |
+    // +--------------------------------+
+    auto bm_view_par_each_transform( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry );
+
+        rst::thread::worker_pool pool{ static_cast<std::size_t>( state.range( 0 ) ) };
+        auto view = registry.view<transform, velocity const>( );
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            view.par_each( pool, []( transform& tf, velocity const& vel ) { integrate( tf, vel ); } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+}
+
+
+BENCHMARK( bm_view_each_transform )->Unit( benchmark::kMillisecond );
+
+// thread count, the calling thread included
+BENCHMARK( bm_view_par_each_transform )
+    ->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->Arg( 16 )
+    ->UseRealTime( )
+    ->Unit( benchmark::kMillisecond );
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+
+namespace
+{
+    using rst::ecs::entity_type;
+
+
+    struct transform
+    {
+        float x{ 0.f }, y{ 0.f }, rotation{ 0.f };
+    };
+
+
+    struct velocity
+    {
+        float dx{ 0.f }, dy{ 0.f };
+    };
+
+
+    struct lifetime
+    {
+        float seconds{ 0.f };
+    };
+
+
+    struct particle_tag { };
+
+
+    constexpr transform spawn_transform{ 10.f, 20.f, 0.f };
+    constexpr velocity spawn_velocity{ 0.f, 40.f };
+    constexpr lifetime spawn_lifetime{ 2.f };
+
+
+    // +--------------------------------+
+    // | SPAWN                          |
+    // +--------------------------------+
+    /**
+     * Reference point: the entities created in bulk, then one emplace per entity and component.
+     */
+    auto bm_spawn_emplace( benchmark::State& state ) -> void
+    {
+        auto const count = static_cast<std::size_t>( state.range( 0 ) );
+        rst::ecs::registry registry{};
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            for ( entity_type const entity : registry.entity_alloc( ).create( count ) )
+            {
+                registry.emplace<transform>( entity, spawn_transform );
+                registry.emplace<velocity>( entity, spawn_velocity );
+                registry.emplace<lifetime>( entity, spawn_lifetime );
+                registry.emplace<particle_tag>( entity );
+            }
+
+            state.PauseTiming( );
+            registry.entity_alloc( ).clear( );
+            state.ResumeTiming( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    /**
+     * The entities created in bulk, then one emplace_n per component: a lookup per pool, an insertion per entity.
+     */
+    auto bm_spawn_emplace_n( benchmark::State& state ) -> void
+    {
+        auto const count = static_cast<std::size_t>( state.range( 0 ) );
+        rst::ecs::registry registry{};
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            std::span<entity_type const> const entities = registry.entity_alloc( ).create( count );
+            registry.emplace_n<transform>( entities, spawn_transform );
+            registry.emplace_n<velocity>( entities, spawn_velocity );
+            registry.emplace_n<lifetime>( entities, spawn_lifetime );
+            registry.emplace_n<particle_tag>( entities, particle_tag{ } );
+
+            state.PauseTiming( );
+            registry.entity_alloc( ).clear( );
+            state.ResumeTiming( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    auto bm_spawn_prefab( benchmark::State& state ) -> void
+    {
+        auto const count = static_cast<std::size_t>( state.range( 0 ) );
+        rst::ecs::registry registry{};
+
+        rst::ecs::prefab particle{};
+        particle.set<transform>( spawn_transform ).set<velocity>( spawn_velocity ).set<lifetime>( spawn_lifetime ).set<particle_tag>( );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            benchmark::DoNotOptimize( particle.instantiate( registry, count ) );
+
+            state.PauseTiming( );
+            registry.entity_alloc( ).clear( );
+            state.ResumeTiming( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+}
+
+
+BENCHMARK( bm_spawn_emplace )->Arg( 1'000 )->Arg( 10'000 );
+BENCHMARK( bm_spawn_emplace_n )->Arg( 1'000 )->Arg( 10'000 );
+BENCHMARK( bm_spawn_prefab )->Arg( 1'000 )->Arg( 10'000 );
@@ -0,0 +1,248 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+#include <rst/data_type/memory_resource.h>
+#include <rst/meta/hash.h>
+
+#include "bench_components.h"
+
+#include <random>
+#include <unordered_map>
+
+
+namespace
+{
+    using rst::bench::component;
+    using rst::ecs::entity_type;
+
+
+    // +--------------------------------+
+    // | HASHED BASELINE                |
+    // +--------------------------------+
+    /**
+     * The previous registry pool lookup: every access hashes the component type into an unordered_map.
+     * Kept here only as a reference point for the dense component index.
+     */
+    class hashed_pool_registry final
+    {
+    public:
+        [[nodiscard]] auto entity_alloc( ) -> rst::ecs::entity_allocator& { return entity_alloc_; }
+
+
+        template <typename TComponent, typename... TArgs>
+        auto emplace( entity_type const entity, TArgs&&... args ) -> TComponent&
+        {
+            return ensure_pool<TComponent>( ).insert_or_replace( entity, std::forward<TArgs>( args )... );
+        }
+
+
+        template <typename... TComponents>
+        [[nodiscard]] auto has( entity_type const entity ) const -> bool
+        {
+            return ( has_impl<TComponents>( entity ) && ... );
+        }
+
+    private:
+        std::unordered_map<rst::meta::hash::hash_type, rst::unique_ref<rst::ecs::detail::base_reg_pool_type>> pools_{};
+        rst::ecs::entity_allocator entity_alloc_{};
+
+
+        template <typename TComponent>
+        [[nodiscard]] auto ensure_pool( ) -> rst::ecs::detail::reg_pool_type<TComponent>&
+        {
+            rst::meta::hash::hash_type const type_hash = rst::meta::hash::type_hash_v<TComponent>;
+            auto [it, inserted] = pools_.try_emplace(
+                type_hash, rst::ref::make_unique<rst::ecs::detail::reg_pool_type<TComponent>>( ) );
+            return static_cast<rst::ecs::detail::reg_pool_type<TComponent>&>( it->second.value( ) );
+        }
+
+
+        template <typename TComponent>
+        [[nodiscard]] auto has_impl( entity_type const entity ) const -> bool
+        {
+            auto const it = pools_.find( rst::meta::hash::type_hash_v<TComponent> );
+            return it != pools_.end( ) && it->second->has( entity );
+        }
+    };
+
+
+    constexpr std::size_t entity_count{ 10'000U };
+
+
+    // +--------------------------------+
+    // | FIXTURE HELPERS                |
+    // +--------------------------------+
+    /**
+     * Creates entity_count entities. Every entity gets component<0>, every other one component<1> and every
+     * fourth one component<2> to component<7>.
+     */
+    template <typename TRegistry>
+    auto populate( TRegistry& registry, std::vector<entity_type> const& entities ) -> void
+    {
+        for ( std::size_t i = 0U; i < entities.size( ); ++i )
+        {
+            entity_type const entity = entities[i];
+            registry.template emplace<component<0>>( entity );
+            if ( i % 2U == 0U ) { registry.template emplace<component<1>>( entity ); }
+            if ( i % 4U == 0U )
+            {
+                [&]<std::size_t... ids>( std::index_sequence<ids...> )
+                {
+                    ( registry.template emplace<component<ids + 2U>>( entity ), ... );
+                }( std::make_index_sequence<6U>{ } );
+            }
+        }
+    }
+
+
+    template <typename TRegistry>
+    auto make_entities( TRegistry& registry ) -> std::vector<entity_type>
+    {
+        std::vector<entity_type> entities( entity_count );
+        std::ranges::generate( entities, [&] { return registry.entity_alloc( ).create( ); } );
+        return entities;
+    }
+
+
+    auto shuffled( std::vector<entity_type> entities ) -> std::vector<entity_type>
+    {
+        std::ranges::shuffle( entities, std::mt19937{ 0xB0A7U } );
+        return entities;
+    }
+
+
+    // +--------------------------------+
+    // | HAS                            |
+    // +--------------------------------+
+    template <typename TRegistry, typename... TComponents>
+    auto bm_registry_has( benchmark::State& state ) -> void
+    {
+        TRegistry registry{};
+        auto const entities = make_entities( registry );
+        populate( registry, entities );
+
+        auto const queries = shuffled( entities );
+        std::size_t cursor{ 0U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            benchmark::DoNotOptimize( std::as_const( registry ).template has<TComponents...>( queries[cursor] ) );
+            cursor = cursor + 1U == queries.size( ) ? 0U : cursor + 1U;
+        }
+        state.SetItemsProcessed( state.iterations( ) );
+    }
+
+
+    // +--------------------------------+
+    // | EMPLACE (REPLACE)              |
+    // +--------------------------------+
+    template <typename TRegistry>
+    auto bm_registry_replace( benchmark::State& state ) -> void
+    {
+        TRegistry registry{};
+        auto const entities = make_entities( registry );
+        populate( registry, entities );
+
+        auto const queries = shuffled( entities );
+        std::size_t cursor{ 0U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            benchmark::DoNotOptimize( registry.template emplace<component<0>>( queries[cursor], 1.f ) );
+            cursor = cursor + 1U == queries.size( ) ? 0U : cursor + 1U;
+        }
+        state.SetItemsProcessed( state.iterations( ) );
+    }
+
+
+    // +--------------------------------+
+    // | EMPLACE (NEW)                  |
+    // +--------------------------------+
+    auto bm_registry_emplace( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        auto const entities = shuffled( make_entities( registry ) );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            for ( entity_type const entity : entities )
+            {
+                benchmark::DoNotOptimize( registry.emplace<component<0>>( entity, 1.f ) );
+            }
+
+            state.PauseTiming( );
+            for ( entity_type const entity : entities ) { registry.remove<component<0>>( entity ); }
+            state.ResumeTiming( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entities.size( ) ) );
+    }
+
+
+    // +--------------------------------+
+    // | VIEW CREATION                  |
+    // +--------------------------------+
+    template <typename... TComponents>
+    auto bm_registry_view_create( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry, make_entities( registry ) );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            auto const view = registry.view<TComponents...>( );
+            benchmark::DoNotOptimize( view );
+        }
+        state.SetItemsProcessed( state.iterations( ) );
+    }
+
+
+    // +--------------------------------+
+    // | LEVEL LOAD/UNLOAD              |
+    // +--------------------------------+
+    /**
+     * Builds a populated registry and tears it down, on the default resource or on an arena sized after a dry run.
+     * The arena variant frees nothing until the whole level is dropped.
+     */
+    template <bool on_arena>
+    auto bm_registry_level_load( benchmark::State& state ) -> void
+    {
+        std::size_t level_bytes{ 0U };
+        {
+            rst::memory::counting_resource counter{};
+            rst::ecs::registry registry{ &counter };
+            populate( registry, make_entities( registry ) );
+            level_bytes = counter.stats( ).peak_bytes;
+        }
+
+        rst::memory::monotonic_arena arena{ level_bytes * 2U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            {
+                rst::ecs::registry registry{ on_arena ? static_cast<std::pmr::memory_resource*>( &arena )
+                                                      : std::pmr::get_default_resource( ) };
+                populate( registry, make_entities( registry ) );
+                benchmark::DoNotOptimize( registry.allocation_stats( ) );
+            }
+            arena.reset( );
+        }
+        state.counters["level_bytes"] = static_cast<double>( level_bytes );
+        state.counters["overflow_bytes"] = static_cast<double>( arena.overflow_bytes( ) );
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count ) );
+    }
+}
+
+
+BENCHMARK_TEMPLATE( bm_registry_has, hashed_pool_registry, component<3> );
+BENCHMARK_TEMPLATE( bm_registry_has, rst::ecs::registry, component<3> );
+
+BENCHMARK_TEMPLATE( bm_registry_has, hashed_pool_registry, component<0>, component<1>, component<5> );
+BENCHMARK_TEMPLATE( bm_registry_has, rst::ecs::registry, component<0>, component<1>, component<5> );
+
+BENCHMARK_TEMPLATE( bm_registry_replace, hashed_pool_registry );
+BENCHMARK_TEMPLATE( bm_registry_replace, rst::ecs::registry );
+
+BENCHMARK( bm_registry_emplace );
+
+BENCHMARK_TEMPLATE( bm_registry_view_create, component<0> );
+BENCHMARK_TEMPLATE( bm_registry_view_create, component<0>, component<1>, component<5> );
+
+BENCHMARK_TEMPLATE( bm_registry_level_load, false );
+BENCHMARK_TEMPLATE( bm_registry_level_load, true );
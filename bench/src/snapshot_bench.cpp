@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+
+namespace
+{
+    using rst::ecs::entity_type;
+
+
+    struct body
+    {
+        float x{ 0.f }, y{ 0.f }, z{ 0.f };
+        float vx{ 0.f }, vy{ 0.f }, vz{ 0.f };
+    };
+
+
+    constexpr std::size_t component_count{ 1'000'000U };
+
+
+    auto populate( rst::ecs::registry& registry ) -> void
+    {
+        std::span<entity_type const> const entities = registry.entity_alloc( ).create( component_count );
+        for ( std::size_t i = 0U; i < entities.size( ); ++i )
+        {
+            registry.emplace<body>( entities[i], static_cast<float>( i ) );
+        }
+    }
+
+
+    auto snapshot_path( ) -> std::filesystem::path
+    {
+        return std::filesystem::temp_directory_path( ) / "rst_snapshot_bench.bin";
+    }
+
+
+    // +--------------------------------+
+    // | MEMORY                         |
+    // +--------------------------------+
+    auto bm_snapshot_save_memory( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry );
+
+        std::vector<std::byte> buffer{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            buffer.clear( );
+            rst::ecs::memory_snapshot_output output{ buffer };
+            rst::ecs::snapshot::save<body>( registry, output );
+            benchmark::DoNotOptimize( buffer.data( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( component_count ) );
+        state.SetBytesProcessed( state.iterations( ) * static_cast<int64_t>( buffer.size( ) ) );
+    }
+
+
+    auto bm_snapshot_load_memory( benchmark::State& state ) -> void
+    {
+        std::vector<std::byte> buffer{};
+        {
+            rst::ecs::registry source{};
+            populate( source );
+            rst::ecs::memory_snapshot_output output{ buffer };
+            rst::ecs::snapshot::save<body>( source, output );
+        }
+
+        rst::ecs::registry registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            rst::ecs::memory_snapshot_input input{ buffer };
+            benchmark::DoNotOptimize( rst::ecs::snapshot::load<body>( registry, input ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( component_count ) );
+        state.SetBytesProcessed( state.iterations( ) * static_cast<int64_t>( buffer.size( ) ) );
+    }
+
+
+    /**
+     * Reference point for load: the same registry rebuilt with one emplace per entity.
+     */
+    auto bm_snapshot_rebuild_emplace( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            registry.entity_alloc( ).clear( );
+            populate( registry );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( component_count ) );
+    }
+
+
+    // +--------------------------------+
+    // | FILE                           |
+    // +--------------------------------+
+    auto bm_snapshot_save_file( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            rst::ecs::file_snapshot_output output{ snapshot_path( ) };
+            rst::ecs::snapshot::save<body>( registry, output );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( component_count ) );
+        state.SetBytesProcessed( state.iterations( ) * static_cast<int64_t>( std::filesystem::file_size( snapshot_path( ) ) ) );
+    }
+
+
+    auto bm_snapshot_load_file( benchmark::State& state ) -> void
+    {
+        {
+            rst::ecs::registry source{};
+            populate( source );
+            rst::ecs::file_snapshot_output output{ snapshot_path( ) };
+            rst::ecs::snapshot::save<body>( source, output );
+        }
+
+        rst::ecs::registry registry{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            rst::ecs::file_snapshot_input input{ snapshot_path( ) };
+            benchmark::DoNotOptimize( rst::ecs::snapshot::load<body>( registry, input ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( component_count ) );
+        state.SetBytesProcessed( state.iterations( ) * static_cast<int64_t>( std::filesystem::file_size( snapshot_path( ) ) ) );
+        std::filesystem::remove( snapshot_path( ) );
+    }
+}
+
+
+BENCHMARK( bm_snapshot_save_memory )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_snapshot_load_memory )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_snapshot_rebuild_emplace )->Unit( benchmark::kMillisecond );
+
+BENCHMARK( bm_snapshot_save_file )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_snapshot_load_file )->Unit( benchmark::kMillisecond );
@@ -0,0 +1,377 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/data_type/sparse_set.h>
+
+#include <numeric>
+#include <random>
+
+
+namespace
+{
+    // +--------------------------------+
+    // | FLAT BASELINE                  |
+    // +--------------------------------+
+    /**
+     * The previous sparse_set layout: one contiguous sparse vector sized to the largest index ever inserted.
+     * Kept here only as a reference point for the paged layout.
+     */
+    template <typename TElement, std::unsigned_integral TIndex = uint32_t>
+    class flat_sparse_set final
+    {
+    public:
+        [[nodiscard]] auto has( TIndex const index ) const noexcept -> bool
+        {
+            return index < sparse_.size( ) && sparse_[index] != 0U;
+        }
+
+
+        auto insert( TIndex const index, TElement const& element ) -> void
+        {
+            if ( index >= sparse_.size( ) )
+            {
+                sparse_.resize( index + 1U, 0U );
+            }
+            sparse_[index] = static_cast<TIndex>( packed_.size( ) ) + 1U;
+            packed_.emplace_back( index );
+            elements_.emplace_back( element );
+        }
+
+
+        [[nodiscard]] auto unsafe_get( TIndex const index ) noexcept -> TElement&
+        {
+            return elements_[sparse_[index] - 1U];
+        }
+
+
+        [[nodiscard]] auto memory_usage( ) const noexcept -> std::size_t
+        {
+            return sparse_.capacity( ) * sizeof( TIndex ) + packed_.capacity( ) * sizeof( TIndex ) +
+                   elements_.capacity( ) * sizeof( TElement );
+        }
+
+    private:
+        std::vector<TIndex> sparse_{};
+        std::vector<TIndex> packed_{};
+        std::vector<TElement> elements_{};
+    };
+
+
+    template <typename TElement>
+    using paged_sparse_set = rst::sparse_set<TElement, uint32_t>;
+
+
+    template <typename TElement>
+    using stable_sparse_set = rst::sparse_set<TElement, uint32_t, rst::sparse_identity_traits<uint32_t>, false, true>;
+
+
+    struct rare_component
+    {
+        float value{ 0.f };
+    };
+
+
+    struct tag_component { };
+
+
+    // +--------------------------------+
+    // | FIXTURE HELPERS                |
+    // +--------------------------------+
+    /**
+     * Simulates a pool for a rare component late in a session: `count` entities that own it, all spawned in the latest
+     * waves (one in every `owner_stride` ids), on top of an id range of `id_range` that only ever grew.
+     */
+    template <typename TSet>
+    auto fill_rare_pool( TSet& set, uint32_t const id_range, uint32_t const count ) -> std::vector<uint32_t>
+    {
+        constexpr uint32_t owner_stride{ 4U };
+
+        std::vector<uint32_t> ids{};
+        ids.reserve( count );
+
+        for ( uint32_t id = id_range; id > owner_stride && ids.size( ) < count; id -= owner_stride )
+        {
+            set.insert( id, rare_component{ static_cast<float>( id ) } );
+            ids.emplace_back( id );
+        }
+        return ids;
+    }
+
+
+    auto make_queries( uint32_t const id_range, std::size_t const count ) -> std::vector<uint32_t>
+    {
+        std::mt19937 rng{ 0xB0A7U };
+        std::uniform_int_distribution<uint32_t> dist{ 1U, id_range };
+
+        std::vector<uint32_t> queries( count );
+        std::ranges::generate( queries, [&] { return dist( rng ); } );
+        return queries;
+    }
+
+
+    // +--------------------------------+
+    // | MEMORY PER POOL                |
+    // +--------------------------------+
+    template <typename TSet>
+    auto bm_pool_memory( benchmark::State& state ) -> void
+    {
+        auto const id_range = static_cast<uint32_t>( state.range( 0 ) );
+        auto const count    = static_cast<uint32_t>( state.range( 1 ) );
+
+        std::size_t bytes{ 0U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            TSet set{};
+            fill_rare_pool( set, id_range, count );
+            bytes = set.memory_usage( );
+            benchmark::DoNotOptimize( bytes );
+        }
+        state.counters["bytes_per_pool"]   = static_cast<double>( bytes );
+        state.counters["bytes_per_element"] = static_cast<double>( bytes ) / static_cast<double>( count );
+    }
+
+
+    // +--------------------------------+
+    // | HAS LATENCY                    |
+    // +--------------------------------+
+    template <typename TSet>
+    auto bm_pool_has( benchmark::State& state ) -> void
+    {
+        auto const id_range = static_cast<uint32_t>( state.range( 0 ) );
+        auto const count    = static_cast<uint32_t>( state.range( 1 ) );
+
+        TSet set{};
+        fill_rare_pool( set, id_range, count );
+        auto const queries = make_queries( id_range, 4096U );
+
+        std::size_t cursor{ 0U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            benchmark::DoNotOptimize( set.has( queries[cursor] ) );
+            cursor = ( cursor + 1U ) & ( queries.size( ) - 1U );
+        }
+        state.SetItemsProcessed( state.iterations( ) );
+    }
+
+
+    // +--------------------------------+
+    // | GET LATENCY                    |
+    // +--------------------------------+
+    template <typename TSet>
+    auto bm_pool_get( benchmark::State& state ) -> void
+    {
+        auto const id_range = static_cast<uint32_t>( state.range( 0 ) );
+        auto const count    = static_cast<uint32_t>( state.range( 1 ) );
+
+        TSet set{};
+        auto ids = fill_rare_pool( set, id_range, count );
+        std::ranges::shuffle( ids, std::mt19937{ 0xB0A7U } );
+
+        std::size_t cursor{ 0U };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            benchmark::DoNotOptimize( set.unsafe_get( ids[cursor] ).value );
+            cursor = cursor + 1U == ids.size( ) ? 0U : cursor + 1U;
+        }
+        state.SetItemsProcessed( state.iterations( ) );
+    }
+
+
+    // +--------------------------------+
+    // | HOT PATH: INSERT               |
+    // +--------------------------------+
+    /**
+     * Dense ids in shuffled order, the way a pool fills up when components are added to existing entities.
+     */
+    auto make_dense_ids( std::size_t const count ) -> std::vector<uint32_t>
+    {
+        std::vector<uint32_t> ids( count );
+        std::iota( ids.begin( ), ids.end( ), 1U );
+        std::ranges::shuffle( ids, std::mt19937{ 0xB0A7U } );
+        return ids;
+    }
+
+
+    auto bm_sparse_set_insert( benchmark::State& state ) -> void
+    {
+        auto const ids = make_dense_ids( static_cast<std::size_t>( state.range( 0 ) ) );
+
+        paged_sparse_set<rare_component> set{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            for ( uint32_t const id : ids )
+            {
+                benchmark::DoNotOptimize( set.insert( id, rare_component{ 1.f } ) );
+            }
+
+            state.PauseTiming( );
+            set.clear( );
+            state.ResumeTiming( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    // +--------------------------------+
+    // | HOT PATH: REMOVE               |
+    // +--------------------------------+
+    auto bm_sparse_set_remove( benchmark::State& state ) -> void
+    {
+        auto const ids = make_dense_ids( static_cast<std::size_t>( state.range( 0 ) ) );
+        auto removal_order = ids;
+        std::ranges::shuffle( removal_order, std::mt19937{ 0x5EEDU } );
+
+        paged_sparse_set<rare_component> set{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            for ( uint32_t const id : ids ) { set.insert( id, rare_component{ 1.f } ); }
+            state.ResumeTiming( );
+
+            for ( uint32_t const id : removal_order )
+            {
+                set.remove( id );
+            }
+            benchmark::DoNotOptimize( set.size( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    /**
+     * Same pattern as bm_sparse_set_remove on a tag set, which has no elements to move.
+     */
+    auto bm_sparse_set_remove_tag( benchmark::State& state ) -> void
+    {
+        auto const ids = make_dense_ids( static_cast<std::size_t>( state.range( 0 ) ) );
+        auto removal_order = ids;
+        std::ranges::shuffle( removal_order, std::mt19937{ 0x5EEDU } );
+
+        paged_sparse_set<tag_component> set{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            for ( uint32_t const id : ids ) { set.insert( id ); }
+            state.ResumeTiming( );
+
+            for ( uint32_t const id : removal_order )
+            {
+                set.remove( id );
+            }
+            benchmark::DoNotOptimize( set.size( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    /**
+     * Same pattern as bm_sparse_set_remove on a pointer-stable set, which leaves tombstones instead of moving the
+     * last element. The refill reuses them.
+     */
+    auto bm_sparse_set_remove_stable( benchmark::State& state ) -> void
+    {
+        auto const ids = make_dense_ids( static_cast<std::size_t>( state.range( 0 ) ) );
+        auto removal_order = ids;
+        std::ranges::shuffle( removal_order, std::mt19937{ 0x5EEDU } );
+
+        stable_sparse_set<rare_component> set{};
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            for ( uint32_t const id : ids ) { set.insert( id, rare_component{ 1.f } ); }
+            state.ResumeTiming( );
+
+            for ( uint32_t const id : removal_order )
+            {
+                set.remove( id );
+            }
+            benchmark::DoNotOptimize( set.size( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    // +--------------------------------+
+    // | HOT PATH: GET                  |
+    // +--------------------------------+
+    auto bm_sparse_set_get( benchmark::State& state ) -> void
+    {
+        auto const ids = make_dense_ids( static_cast<std::size_t>( state.range( 0 ) ) );
+
+        paged_sparse_set<rare_component> set{};
+        for ( uint32_t const id : ids ) { set.insert( id, rare_component{ static_cast<float>( id ) } ); }
+
+        auto queries = ids;
+        std::ranges::shuffle( queries, std::mt19937{ 0x5EEDU } );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            for ( uint32_t const id : queries )
+            {
+                benchmark::DoNotOptimize( set.unsafe_get( id ).value );
+            }
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+
+
+    // +--------------------------------+
+    // | SORT                           |
+    // +--------------------------------+
+    /**
+     * Sorts a pool by value once per frame: between two passes `moved` elements get a new random key, the case of
+     * sprites kept in z order. moved = 0 is the already sorted pass, moved = count a full shuffle.
+     */
+    auto bm_sparse_set_sort( benchmark::State& state ) -> void
+    {
+        auto const count = static_cast<std::size_t>( state.range( 0 ) );
+        auto const moved = static_cast<std::size_t>( state.range( 1 ) );
+        auto const ids   = make_dense_ids( count );
+
+        paged_sparse_set<rare_component> set{};
+        for ( uint32_t const id : ids ) { set.insert( id, rare_component{ static_cast<float>( id ) } ); }
+
+        auto const by_value = []( rare_component const& lhs, rare_component const& rhs ) { return lhs.value < rhs.value; };
+        set.sort( by_value );
+
+        std::mt19937 rng{ 0x5EEDU };
+        std::uniform_int_distribution<uint32_t> dist{ 1U, static_cast<uint32_t>( count ) };
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            for ( std::size_t i = 0U; i < moved; ++i )
+            {
+                set.unsafe_get( ids[dist( rng ) - 1U] ).value = static_cast<float>( dist( rng ) );
+            }
+            state.ResumeTiming( );
+
+            set.sort( by_value );
+            benchmark::DoNotOptimize( set.data( ).data( ) );
+        }
+        state.SetItemsProcessed( state.iterations( ) * state.range( 0 ) );
+    }
+}
+
+
+// id range (lifetime entity count) x pool size (live owners of the component)
+#define RST_RARE_POOL_ARGS ArgsProduct( { { 1'000, 100'000, 1'000'000 }, { 64, 4'096 } } )
+
+BENCHMARK_TEMPLATE( bm_pool_memory, flat_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+BENCHMARK_TEMPLATE( bm_pool_memory, paged_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+
+BENCHMARK_TEMPLATE( bm_pool_has, flat_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+BENCHMARK_TEMPLATE( bm_pool_has, paged_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+
+BENCHMARK_TEMPLATE( bm_pool_get, flat_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+BENCHMARK_TEMPLATE( bm_pool_get, paged_sparse_set<rare_component> )->RST_RARE_POOL_ARGS;
+
+// pool size
+#define RST_HOT_PATH_ARGS RangeMultiplier( 10 )->Range( 1'000, 100'000 )
+
+BENCHMARK( bm_sparse_set_insert )->RST_HOT_PATH_ARGS;
+BENCHMARK( bm_sparse_set_remove )->RST_HOT_PATH_ARGS;
+BENCHMARK( bm_sparse_set_remove_tag )->RST_HOT_PATH_ARGS;
+BENCHMARK( bm_sparse_set_remove_stable )->RST_HOT_PATH_ARGS;
+BENCHMARK( bm_sparse_set_get )->RST_HOT_PATH_ARGS;
+
+// pool size x elements whose key changed since the last sort
+BENCHMARK( bm_sparse_set_sort )->ArgsProduct( { { 10'000, 100'000 }, { 0, 8, 10'000 } } );
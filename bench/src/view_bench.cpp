@@ -0,0 +1,198 @@
+#include <benchmark/benchmark.h>
+
+#include <rst/__core/ecs.h>
+
+#include "bench_components.h"
+
+#include <random>
+
+
+namespace
+{
+    using rst::bench::component;
+    using rst::ecs::entity_type;
+
+
+    struct tracked_component
+    {
+        static constexpr bool track_changes{ true };
+        float value{ 1.f };
+    };
+
+
+    constexpr std::size_t entity_count{ 100'000U };
+
+
+    // +--------------------------------+
+    // | FIXTURE HELPERS                |
+    // +--------------------------------+
+    /**
+     * Every entity gets component<0>. Every further pool holds entity_count / skew entities, the same ones in
+     * each pool, inserted in an order of its own: the view intersection is entity_count / skew entities and the
+     * packed arrays never line up.
+     */
+    template <std::size_t... ids>
+    auto populate( rst::ecs::registry& registry, std::size_t const skew, std::index_sequence<ids...> ) -> void
+    {
+        std::vector<entity_type> entities( entity_count );
+        for ( entity_type& entity : entities )
+        {
+            entity = registry.entity_alloc( ).create( );
+            registry.emplace<component<0>>( entity );
+        }
+
+        std::mt19937 rng{ 0xB0A7U };
+        std::ranges::shuffle( entities, rng );
+        std::vector<entity_type> owners{ entities.begin( ), entities.begin( ) + entity_count / skew };
+
+        [[maybe_unused]] auto const fill = [&]<std::size_t id>( std::integral_constant<std::size_t, id> )
+        {
+            std::ranges::shuffle( owners, rng );
+            for ( entity_type const entity : owners ) { registry.emplace<component<id + 1U>>( entity ); }
+        };
+        ( fill( std::integral_constant<std::size_t, ids>{ } ), ... );
+    }
+
+
+    // +--------------------------------+
+    // | VIEW EACH                      |
+    // +--------------------------------+
+    template <std::size_t component_count>
+    auto bm_view_each( benchmark::State& state ) -> void
+    {
+        auto const skew = static_cast<std::size_t>( state.range( 0 ) );
+
+        rst::ecs::registry registry{};
+        populate( registry, skew, std::make_index_sequence<component_count - 1U>{ } );
+
+        [&]<std::size_t... ids>( std::index_sequence<ids...> )
+        {
+            auto view = registry.view<component<ids>...>( );
+            for ( [[maybe_unused]] auto _ : state )
+            {
+                view.each( []( component<ids>&... components ) { ( ( components.value += 1.f ), ... ); } );
+                benchmark::ClobberMemory( );
+            }
+        }( std::make_index_sequence<component_count>{ } );
+
+        auto const matched = component_count == 1U ? entity_count : entity_count / skew;
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( matched ) );
+    }
+
+
+    /**
+     * Same pass as bm_view_each, through a view built from type hashes, as an editor or a script would.
+     */
+    template <std::size_t component_count>
+    auto bm_runtime_view_each( benchmark::State& state ) -> void
+    {
+        auto const skew = static_cast<std::size_t>( state.range( 0 ) );
+
+        rst::ecs::registry registry{};
+        populate( registry, skew, std::make_index_sequence<component_count - 1U>{ } );
+
+        [&]<std::size_t... ids>( std::index_sequence<ids...> )
+        {
+            std::array const components{ rst::meta::hash::type_hash_v<component<ids>>... };
+            auto const view = registry.runtime_view( components );
+            for ( [[maybe_unused]] auto _ : state )
+            {
+                view.each(
+                    []( entity_type, std::span<void* const> const values )
+                    {
+                        ( ( static_cast<component<ids>*>( values[ids] )->value += 1.f ), ... );
+                    } );
+                benchmark::ClobberMemory( );
+            }
+        }( std::make_index_sequence<component_count>{ } );
+
+        auto const matched = component_count == 1U ? entity_count : entity_count / skew;
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( matched ) );
+    }
+
+
+    // +--------------------------------+
+    // | VIEW CHANGED                   |
+    // +--------------------------------+
+    /**
+     * One entity every `stride` is written between two passes, the pass only visits those through changed<T>.
+     */
+    auto bm_view_changed( benchmark::State& state ) -> void
+    {
+        auto const stride = static_cast<std::size_t>( state.range( 0 ) );
+
+        rst::ecs::registry registry{};
+        std::vector<entity_type> entities( entity_count );
+        for ( entity_type& entity : entities )
+        {
+            entity = registry.entity_alloc( ).create( );
+            registry.emplace<tracked_component>( entity );
+            registry.emplace<component<0>>( entity );
+        }
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            state.PauseTiming( );
+            rst::ecs::tick_type const since = registry.advance_tick( );
+            registry.advance_tick( );
+            for ( std::size_t i = 0U; i < entity_count; i += stride ) { registry.emplace<tracked_component>( entities[i] ); }
+            state.ResumeTiming( );
+
+            registry.view<component<0>, tracked_component const, rst::ecs::changed<tracked_component>>( since ).each(
+                []( component<0>& target, tracked_component const& source ) { target.value += source.value; } );
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count / stride ) );
+    }
+
+
+    // +--------------------------------+
+    // | VIEW EXCLUDE                   |
+    // +--------------------------------+
+    /**
+     * One entity in four has component<1>, the pass skips them through exclude<T> or through a registry lookup.
+     */
+    template <bool use_exclude>
+    auto bm_view_exclude( benchmark::State& state ) -> void
+    {
+        rst::ecs::registry registry{};
+        populate( registry, 4U, std::make_index_sequence<1U>{ } );
+
+        for ( [[maybe_unused]] auto _ : state )
+        {
+            if constexpr ( use_exclude )
+            {
+                registry.view<component<0>, rst::ecs::exclude<component<1>>>( ).each(
+                    []( component<0>& target ) { target.value += 1.f; } );
+            }
+            else
+            {
+                registry.view<component<0>>( ).each(
+                    [&registry]( entity_type const entity, component<0>& target )
+                    {
+                        if ( not registry.has<component<1>>( entity ) ) { target.value += 1.f; }
+                    } );
+            }
+            benchmark::ClobberMemory( );
+        }
+        state.SetItemsProcessed( state.iterations( ) * static_cast<int64_t>( entity_count - entity_count / 4U ) );
+    }
+}
+
+
+// skew: component<0> pool size / size of every other pool
+#define RST_VIEW_SKEW_ARGS Arg( 1 )->Arg( 4 )->Arg( 64 )
+
+BENCHMARK_TEMPLATE( bm_view_each, 1 )->Arg( 1 );
+BENCHMARK_TEMPLATE( bm_view_each, 2 )->RST_VIEW_SKEW_ARGS;
+BENCHMARK_TEMPLATE( bm_view_each, 3 )->RST_VIEW_SKEW_ARGS;
+BENCHMARK_TEMPLATE( bm_view_each, 4 )->RST_VIEW_SKEW_ARGS;
+
+BENCHMARK_TEMPLATE( bm_runtime_view_each, 1 )->Arg( 1 );
+BENCHMARK_TEMPLATE( bm_runtime_view_each, 3 )->RST_VIEW_SKEW_ARGS;
+
+// stride: entities per changed entity
+BENCHMARK( bm_view_changed )->Arg( 1 )->Arg( 100 )->Arg( 10'000 );
+
+BENCHMARK_TEMPLATE( bm_view_exclude, true );
+BENCHMARK_TEMPLATE( bm_view_exclude, false );
@@ -0,0 +1,17 @@
+include( FetchContent )
+
+macro( fetch_benchmark )
+    # google benchmark, only the library itself is needed
+    set( BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE )
+    set( BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE )
+    set( BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE )
+
+    fetchcontent_declare(
+            benchmark
+            URL https://github.com/google/benchmark/archive/refs/tags/v1.9.1.zip
+            DOWNLOAD_NO_PROGRESS ON
+            DOWNLOAD_DIR ${CMAKE_BINARY_DIR}/downloads
+    )
+    fetchcontent_makeavailable( benchmark )
+    target_link_libraries( ${PROJECT_NAME} PRIVATE benchmark::benchmark benchmark::benchmark_main )
+endmacro()
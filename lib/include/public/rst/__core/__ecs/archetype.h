@@ -0,0 +1,183 @@
+#ifndef RST_ECS_ARCHETYPE_H
+#define RST_ECS_ARCHETYPE_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_index.h>
+#include <rst/__core/__ecs/entity.h>
+
+
+namespace rst::ecs::detail
+{
+    /**
+     * Size and alignment of a component type, what an archetype needs to lay out its column. Tags (empty types) have
+     * a size of 0 and get no column.
+     */
+    struct component_layout final
+    {
+        meta::sequential_index_type id{ 0U };
+        uint32_t size{ 0U };
+        uint32_t alignment{ 0U };
+    };
+
+
+    /**
+     * @brief Table of the entities sharing one exact set of components, see archetype_registry.
+     *
+     * Rows are stored in fixed-size chunks: each chunk holds the entities of its rows, then one array per component,
+     * so that iterating a chunk walks a handful of contiguous arrays that fit in L1 together. Rows are kept dense by
+     * swap-and-pop, so the last row moves whenever another one is erased. Components are trivially copyable and
+     * move between tables with memcpy.
+     *
+     * Every table also caches its graph edges: the table reached by adding or removing each component, so that
+     * structural changes after the first one never look a table up.
+     */
+    class archetype final
+    {
+    public:
+        /**
+         * Bytes per chunk: half of a 32 KiB L1 data cache, so that the chunk being iterated and the code touching it
+         * stay resident, and a few chunks of the same table fit in L2.
+         */
+        static constexpr std::size_t chunk_bytes{ 16'384U };
+
+        /**
+         * Column returned for components that have none in the table, tags included.
+         */
+        static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max( ) };
+
+
+        struct edge final
+        {
+            archetype* add{ nullptr };    // the table with the component added, once known
+            archetype* remove{ nullptr }; // the table with the component removed, once known
+        };
+
+
+        /**
+         * @param layouts The components of the table, sorted by id.
+         * @param resource Where the chunks are allocated from, must outlive the table.
+         */
+        archetype( std::span<component_layout const> layouts, std::pmr::memory_resource* resource );
+        ~archetype( ) noexcept;
+
+        archetype( archetype const& )                        = delete;
+        archetype( archetype&& ) noexcept                    = delete;
+        auto operator=( archetype const& ) -> archetype&     = delete;
+        auto operator=( archetype&& ) noexcept -> archetype& = delete;
+
+        /**
+         * @brief Adds a row for @entity, allocating a chunk if the last one is full. The components of the row are
+         * left uninitialised.
+         * @complexity O(1) amortized
+         * @return The new row.
+         */
+        auto append( entity_type entity ) -> std::size_t;
+
+        /**
+         * @brief Copies the components @source has in common with this table from @source_row to @row.
+         * @complexity O(c) where c is the number of columns of both tables
+         */
+        auto copy_row( archetype const& source, std::size_t source_row, std::size_t row ) noexcept -> void;
+
+        /**
+         * @brief Removes @row, moving the last row into its place.
+         * @complexity O(c) where c is the number of columns
+         * @return The entity now at @row, or null_entity if @row was the last one.
+         */
+        auto erase( std::size_t row ) noexcept -> entity_type;
+
+        /**
+         * @brief Removes every row, keeping the chunks.
+         */
+        auto clear( ) noexcept -> void;
+
+        /**
+         * @complexity O(log k) where k is the number of components of the table
+         * @return True if the table has the component @id, tags included.
+         */
+        [[nodiscard]] auto includes( meta::sequential_index_type id ) const noexcept -> bool;
+
+        /**
+         * @complexity O(k) where k is the number of components of the table
+         * @param ids Component ids, sorted.
+         * @return True if the table has every component of @ids.
+         */
+        [[nodiscard]] auto includes( std::span<meta::sequential_index_type const> ids ) const noexcept -> bool;
+
+        /**
+         * @complexity O(log k) where k is the number of components of the table
+         * @return The column of component @id, npos for tags and for components the table lacks.
+         */
+        [[nodiscard]] auto column_of( meta::sequential_index_type id ) const noexcept -> std::size_t;
+
+        /**
+         * @return The component of @row in @column.
+         */
+        [[nodiscard]] auto component( std::size_t row, std::size_t column ) const noexcept -> std::byte*;
+
+        /**
+         * @return The first component of @chunk in @column, the others follow contiguously.
+         */
+        [[nodiscard]] auto chunk_column( std::size_t chunk, std::size_t column ) const noexcept -> std::byte*;
+
+        /**
+         * @return The entities of the rows of @chunk.
+         */
+        [[nodiscard]] auto chunk_entities( std::size_t chunk ) const noexcept -> std::span<entity_type const>;
+
+        /**
+         * @return The entity of @row.
+         */
+        [[nodiscard]] auto entity( std::size_t row ) const noexcept -> entity_type;
+
+        /**
+         * @return The cached edges of component @id, empty until the registry fills them.
+         */
+        [[nodiscard]] auto edge_of( meta::sequential_index_type id ) -> edge&;
+
+        /**
+         * @return The components of the table, sorted by id, tags included.
+         */
+        [[nodiscard]] auto layouts( ) const noexcept -> std::span<component_layout const>;
+
+        /**
+         * @return Number of chunks holding rows.
+         */
+        [[nodiscard]] auto chunk_count( ) const noexcept -> std::size_t;
+
+        /**
+         * @return Rows per chunk.
+         */
+        [[nodiscard]] auto chunk_capacity( ) const noexcept -> std::size_t;
+
+        /**
+         * @return Number of rows.
+         */
+        [[nodiscard]] auto size( ) const noexcept -> std::size_t;
+
+    private:
+        // every column starts on a cache line, or on its own alignment if stricter
+        static constexpr std::size_t cache_line_alignment_{ 64U };
+
+        std::pmr::memory_resource* const resource_ptr_;
+
+        std::vector<component_layout> layouts_{};  // every component, sorted by id
+        std::vector<std::size_t> columns_{};        // index in layouts_ of each component with a column
+        std::vector<std::size_t> column_offsets_{}; // byte offset of each column in a chunk
+
+        std::size_t chunk_alignment_{ cache_line_alignment_ }; // the strictest column alignment
+        std::size_t chunk_capacity_{ 0U };
+        std::size_t chunk_size_{ 0U }; // bytes, within chunk_bytes unless a single row is larger
+        std::vector<std::byte*> chunks_{};
+        std::size_t size_{ 0U };
+
+        std::vector<edge> edges_{}; // indexed by component id
+
+
+        [[nodiscard]] auto entities_of( std::size_t chunk ) const noexcept -> entity_type*;
+    };
+}
+
+
+#endif //!RST_ECS_ARCHETYPE_H
@@ -0,0 +1,269 @@
+#ifndef RST_ECS_ARCHETYPE_REGISTRY_H
+#define RST_ECS_ARCHETYPE_REGISTRY_H
+
+#include <rst/pch.h>
+
+#include <rst/diagnostic.h>
+#include <rst/data_type/unique_ref.h>
+#include <rst/__core/__ecs/archetype.h>
+#include <rst/__core/__ecs/archetype_view.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/component_traits.h>
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/entity_allocator.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief Registry storing components in archetype tables instead of one sparse set per component type.
+     *
+     * Entities with the same set of components share a table, whose components live in parallel arrays split into
+     * L1-sized chunks (see detail::archetype). Views match whole tables and walk their arrays, so iterating costs no
+     * membership test at all, where registry intersects sparse sets entity by entity. The price is paid on structural
+     * changes: adding or removing a component copies the entity's row into another table. Tables are linked by cached
+     * edges, so a change only looks a table up the first time it is made from a given table.
+     *
+     * Pick it over registry for worlds whose entities rarely change shape and are iterated heavily, e.g. level
+     * geometry or particles stamped out once. It offers the same entity_alloc, emplace, remove, has and view calls, so
+     * systems written as templates over the registry type run on both.
+     *
+     * @code
+     * rst::ecs::archetype_registry world{};
+     *
+     * entity_type const rock = world.entity_alloc( ).create( );
+     * world.emplace<transform>( rock );
+     * world.emplace<collider>( rock, bounds );
+     *
+     * world.view<transform, collider const>( ).each( []( transform& tf, collider const& col ) { ... } );
+     * @endcode
+     *
+     * @note Views take required components only: no optional<T>, exclude<T...> nor tick filters. There are no
+     * component signals, groups, change ticks nor pointer-stable components, which all need a pool per type.
+     */
+    class archetype_registry final
+    {
+    public:
+        archetype_registry( ) : archetype_registry{ std::pmr::get_default_resource( ) } { }
+
+        /**
+         * @param resource Where the chunks, the entity locations and the entity slots are allocated from, must
+         * outlive the registry.
+         */
+        explicit archetype_registry( std::pmr::memory_resource* resource );
+        ~archetype_registry( ) noexcept = default;
+
+        archetype_registry( archetype_registry const& )                        = delete;
+        archetype_registry( archetype_registry&& ) noexcept                    = delete;
+        auto operator=( archetype_registry const& ) -> archetype_registry&     = delete;
+        auto operator=( archetype_registry&& ) noexcept -> archetype_registry& = delete;
+
+        /**
+         * @complexity O(1)
+         * @return Reference to the internal entity allocator.
+         */
+        [[nodiscard]] auto entity_alloc( ) -> entity_allocator&
+        {
+            return entity_alloc_;
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @return True if the entity was created and not destroyed since, false for stale or null handles.
+         */
+        [[nodiscard]] auto alive( entity_type const entity ) const noexcept -> bool
+        {
+            return entity_alloc_.alive( entity );
+        }
+
+
+        /**
+         * @brief Constructs a component of type TComponent for the given entity, replacing the one it has if any.
+         *
+         * @complexity O(1) to replace. O(c) to add, where c is the number of components of the entity: its row is
+         * copied into the table with TComponent added, found through the cached edge
+         * @tparam TComponent Non-const, non-reference type of the component to emplace.
+         * @param entity The entity to attach the component to.
+         * @param args Constructor arguments forwarded to TComponent's constructor.
+         * @return Reference to the component, valid until the entity changes table or another entity leaves it.
+         *
+         * @note The entity must be alive, emplacing on a stale handle asserts.
+         */
+        template <detail::ecs_component TComponent, typename... TArgs>
+            requires ( std::constructible_from<TComponent, TArgs...> && not pointer_stable<TComponent> )
+        auto emplace( entity_type const entity, TArgs&&... args ) -> TComponent&
+        {
+            ensure( alive( entity ), "emplace on a dead or stale entity!" );
+            meta::sequential_index_type const id = component_index<TComponent>( );
+
+            entity_location& location = location_of( entity );
+            if ( location.table == nullptr || not location.table->includes( id ) )
+            {
+                detail::archetype& source = location.table != nullptr ? *location.table : root_;
+                detail::archetype::edge& edge = source.edge_of( id );
+                if ( edge.add == nullptr )
+                {
+                    edge.add = &table_with( source, layout_of<TComponent>( ) );
+                }
+                move_entity( entity, location, *edge.add );
+            }
+
+            if constexpr ( std::is_empty_v<TComponent> )
+            {
+                static TComponent instance{};
+                return instance;
+            }
+            else
+            {
+                std::byte* const storage = location.table->component( location.row, location.table->column_of( id ) );
+                return *std::construct_at( reinterpret_cast<TComponent*>( storage ), std::forward<TArgs>( args )... );
+            }
+        }
+
+
+        /**
+         * @brief Removes the component of type TComponent from the given entity, if it has one.
+         *
+         * @complexity O(c) where c is the number of components of the entity: its row is copied into the table
+         * without TComponent, found through the cached edge
+         * @tparam TComponent The component type to remove.
+         * @param entity The entity to remove the component from.
+         */
+        template <detail::ecs_component TComponent>
+        auto remove( entity_type const entity ) -> void
+        {
+            if ( not has<TComponent>( entity ) ) { return; }
+
+            meta::sequential_index_type const id = component_index<TComponent>( );
+            entity_location& location          = locations_[entity_traits::to_index( entity )];
+
+            detail::archetype::edge& edge = location.table->edge_of( id );
+            if ( edge.remove == nullptr )
+            {
+                edge.remove = &table_without( *location.table, id );
+            }
+            move_entity( entity, location, *edge.remove );
+        }
+
+
+        /**
+         * @complexity O(k log c) where k is the number of component types and c the number of components of the entity
+         * @tparam TComponents The component types to check for.
+         * @return True if the entity has all specified components, false otherwise. Always false for stale handles.
+         */
+        template <detail::viewable_ecs_component... TComponents>
+        [[nodiscard]] auto has( entity_type const entity ) const -> bool
+        {
+            if ( not alive( entity ) ) { return false; }
+
+            entity_traits::index_type const index = entity_traits::to_index( entity );
+            detail::archetype const* table        = index < locations_.size( ) ? locations_[index].table : nullptr;
+            return table != nullptr && ( table->includes( component_index<TComponents>( ) ) && ... );
+        }
+
+
+        /**
+         * @brief Creates a view over the entities that have every component of TComponents.
+         *
+         * @complexity O(t×k) where t is the number of tables and k the number of components of the largest one.
+         * @tparam TComponents The component types that entities must have, const ones are handed out read-only.
+         * @return The view, over the tables that exist now.
+         */
+        template <detail::viewable_ecs_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
+        [[nodiscard]] auto view( ) -> archetype_view<TComponents...>
+        {
+            std::array<meta::sequential_index_type, sizeof...( TComponents )> ids{ component_index<TComponents>( )... };
+            std::array<meta::sequential_index_type, sizeof...( TComponents )> sorted = ids;
+            std::ranges::sort( sorted );
+
+            std::vector<typename archetype_view<TComponents...>::match> matches{};
+            for ( auto& table : tables_ )
+            {
+                if ( table->size( ) == 0U || not table->includes( sorted ) ) { continue; }
+
+                auto& match = matches.emplace_back( );
+                match.table = &table.value( );
+                std::ranges::transform( ids, match.columns.begin( ), [&table]( auto const id ) { return table->column_of( id ); } );
+            }
+            return archetype_view<TComponents...>{ std::move( matches ) };
+        }
+
+
+        /**
+         * @return Number of tables, one per set of components some entity had.
+         */
+        [[nodiscard]] auto archetype_count( ) const noexcept -> std::size_t;
+
+        /**
+         * @return The resource the registry storage is allocated from.
+         */
+        [[nodiscard]] auto resource( ) const noexcept -> std::pmr::memory_resource*;
+
+    private:
+        struct entity_location final
+        {
+            detail::archetype* table{ nullptr }; // null while the entity has no component
+            std::size_t row{ 0U };
+        };
+
+
+        std::pmr::memory_resource* const resource_ptr_;
+
+        // the table of the entities without components, holds no rows and only serves its edges
+        detail::archetype root_;
+        std::vector<unique_ref<detail::archetype>> tables_{};
+
+        // indexed by entity index
+        std::pmr::vector<entity_location> locations_;
+
+        entity_allocator entity_alloc_;
+
+
+        template <detail::viewable_ecs_component TComponent>
+        [[nodiscard]] static auto component_index( ) noexcept -> meta::sequential_index_type
+        {
+            return detail::component_sequence::index_of<TComponent>( );
+        }
+
+
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] static auto layout_of( ) noexcept -> detail::component_layout
+        {
+            return {
+                component_index<TComponent>( ),
+                std::is_empty_v<TComponent> ? 0U : static_cast<uint32_t>( sizeof( TComponent ) ),
+                static_cast<uint32_t>( alignof( TComponent ) )
+            };
+        }
+
+
+        [[nodiscard]] auto location_of( entity_type entity ) -> entity_location&;
+
+        /**
+         * @brief Moves the row of @entity to @target, copying the components both tables have.
+         * @complexity O(c) where c is the number of components of the two tables
+         */
+        auto move_entity( entity_type entity, entity_location& location, detail::archetype& target ) -> void;
+
+        /**
+         * @return The table with the components of @source and @added, created on first use
+         */
+        [[nodiscard]] auto table_with( detail::archetype const& source, detail::component_layout added ) -> detail::archetype&;
+
+        /**
+         * @return The table with the components of @source but @removed, created on first use
+         */
+        [[nodiscard]] auto table_without( detail::archetype const& source, meta::sequential_index_type removed ) -> detail::archetype&;
+
+        [[nodiscard]] auto find_or_create_table( std::span<detail::component_layout const> layouts ) -> detail::archetype&;
+
+        auto destroy_entity( entity_type entity ) -> void;
+        auto destroy_entities( std::span<entity_type const> entities ) -> void;
+        auto clear_entities( ) -> void;
+    };
+}
+
+
+#endif //!RST_ECS_ARCHETYPE_REGISTRY_H
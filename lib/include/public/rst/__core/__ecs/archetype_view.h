@@ -0,0 +1,203 @@
+#ifndef RST_ECS_ARCHETYPE_VIEW_H
+#define RST_ECS_ARCHETYPE_VIEW_H
+
+#include <rst/pch.h>
+
+#include <rst/__core/__ecs/archetype.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/entity.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief A view over the entities of an archetype_registry that have all of TComponents.
+     *
+     * The view holds the tables whose components include TComponents, with the column of each component in each
+     * table. Iterating is a walk over their chunks: no pivot, no membership test and no lookup per entity, each
+     * component is read from a contiguous array.
+     *
+     * @code
+     * auto movement = world.view<transform, velocity const>();
+     *
+     * movement.each([](transform& tf, velocity const& vel) { tf.translate(vel.direction * vel.speed); });
+     *
+     * movement.each_chunk([](std::span<transform> transforms, std::span<velocity const> velocities) {
+     *     // same length, same entity at the same position
+     * });
+     * @endcode
+     *
+     * @note The view sees the tables that existed when it was created, create it for each pass like registry views.
+     * Adding or removing components moves entities between tables: record structural changes in a command buffer of
+     * your own and apply them after the loop.
+     * @note Tags (empty component types) have no column, every entity is handed the same instance.
+     *
+     * @tparam TComponents The component types that entities must possess, const ones are handed out read-only.
+     */
+    template <detail::viewable_ecs_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
+    class archetype_view final
+    {
+    public:
+        /**
+         * A table the view walks, with the column of each of TComponents in it (npos for tags).
+         */
+        struct match final
+        {
+            detail::archetype* table{ nullptr };
+            std::array<std::size_t, sizeof...( TComponents )> columns{};
+        };
+
+
+        /**
+         * @brief Constructs a view over @matches. Use archetype_registry::view to get one.
+         * @complexity O(1)
+         */
+        explicit archetype_view( std::vector<match> matches ) noexcept : matches_{ std::move( matches ) } { }
+
+
+        /**
+         * @complexity O(t) where t is the number of tables of the view.
+         * @return Number of entities in the view.
+         */
+        [[nodiscard]] auto size( ) const noexcept -> std::size_t
+        {
+            std::size_t total{ 0U };
+            for ( match const& table_match : matches_ ) { total += table_match.table->size( ); }
+            return total;
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with entity ID and component references.
+         *
+         * @tparam TDelegate Function type that accepts (entity_type, TComponents&...).
+         * @param delegate Function to apply to each entity and its components.
+         *
+         * @complexity O(n) where n is the number of entities in the view.
+         */
+        template <std::invocable<entity_type, TComponents&...> TDelegate>
+        auto each( TDelegate&& delegate ) const -> void
+        {
+            each_impl<true>( delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with component references only.
+         *
+         * @tparam TDelegate Function type that accepts (TComponents&...).
+         * @param delegate Function to apply to each entity's components.
+         *
+         * @complexity O(n) where n is the number of entities in the view.
+         */
+        template <std::invocable<TComponents&...> TDelegate>
+        auto each( TDelegate&& delegate ) const -> void
+        {
+            each_impl<false>( delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to every chunk of the view, the entities and one span per component.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<entity_type const>, std::span<TComponents>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(c) where c is the number of chunks of the view.
+         * @note Tags are handed out from a shared buffer, there is nothing to write.
+         */
+        template <std::invocable<std::span<entity_type const>, std::span<TComponents>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const -> void
+        {
+            each_chunk_impl<true>( delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to every chunk of the view, one span per component.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<TComponents>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(c) where c is the number of chunks of the view.
+         */
+        template <std::invocable<std::span<TComponents>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const -> void
+        {
+            each_chunk_impl<false>( delegate );
+        }
+
+    private:
+        std::vector<match> const matches_;
+
+
+        /**
+         * @return The components of @chunk in @column, a shared buffer for tags
+         */
+        template <typename TComponent>
+        [[nodiscard]] static auto chunk_of(
+            detail::archetype const& table, std::size_t const chunk, std::size_t const column,
+            std::size_t const count ) noexcept -> std::span<TComponent>
+        {
+            using component_type = std::remove_const_t<TComponent>;
+            if constexpr ( std::is_empty_v<component_type> )
+            {
+                static std::array<component_type, detail::archetype::chunk_bytes / sizeof( entity_type )> buffer{};
+                return std::span<TComponent>{ buffer }.first( count );
+            }
+            else
+            {
+                return { reinterpret_cast<component_type*>( table.chunk_column( chunk, column ) ), count };
+            }
+        }
+
+
+        template <bool include_entity, typename TDelegate>
+        auto each_impl( TDelegate& delegate ) const -> void
+        {
+            auto per_entity = [&delegate]( std::span<entity_type const> const entities, std::span<TComponents> const... components )
+                {
+                    for ( std::size_t row = 0U; row < entities.size( ); ++row )
+                    {
+                        if constexpr ( include_entity )
+                        {
+                            delegate( entities[row], components[row]... );
+                        }
+                        else
+                        {
+                            delegate( components[row]... );
+                        }
+                    }
+                };
+            each_chunk_impl<true>( per_entity );
+        }
+
+
+        template <bool include_entities, typename TDelegate>
+        auto each_chunk_impl( TDelegate& delegate ) const -> void
+        {
+            [&]<std::size_t... ids>( std::index_sequence<ids...> )
+            {
+                for ( match const& table_match : matches_ )
+                {
+                    detail::archetype const& table = *table_match.table;
+                    for ( std::size_t chunk = 0U; chunk < table.chunk_count( ); ++chunk )
+                    {
+                        std::span<entity_type const> const entities = table.chunk_entities( chunk );
+                        if constexpr ( include_entities )
+                        {
+                            delegate( entities, chunk_of<TComponents>( table, chunk, table_match.columns[ids], entities.size( ) )... );
+                        }
+                        else
+                        {
+                            delegate( chunk_of<TComponents>( table, chunk, table_match.columns[ids], entities.size( ) )... );
+                        }
+                    }
+                }
+            }( std::index_sequence_for<TComponents...>{ } );
+        }
+    };
+}
+
+
+#endif //!RST_ECS_ARCHETYPE_VIEW_H
@@ -0,0 +1,259 @@
+#ifndef RST_ECS_COMMAND_BUFFER_H
+#define RST_ECS_COMMAND_BUFFER_H
+
+#include <rst/pch.h>
+
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/registry.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief Handle to an entity created through a command_buffer, valid inside that buffer until playback.
+     */
+    struct deferred_entity final
+    {
+        uint32_t id;
+    };
+
+
+    /**
+     * @brief Records structural changes (entity creation and destruction, component addition and removal) to
+     * apply them to a registry later, at a point where no view is being iterated.
+     *
+     * Recording only appends to the buffer's own arrays, it never touches the registry, so one buffer per thread
+     * can record concurrently with other threads iterating the registry. Component values are copied into a
+     * linear byte arena (components are trivially copyable), nothing is allocated per command.
+     *
+     * Playback is batched per pool: commands are sorted by component, then by entity, each pool is reserved once
+     * and filled or emptied in a single pass. Ordering guarantees:
+     * - entities created by the buffer exist before any component is added;
+     * - commands on the same component of the same entity keep their recording order;
+     * - destructions run last, so destroying an entity always wins over components recorded for it;
+     * - components recorded for entities that are dead by playback time are dropped.
+     *
+     * @code
+     * command_buffer commands{};
+     *
+     * view.each([&](entity_type entity, health const& hp) {
+     *     if (hp.value <= 0) {
+     *         commands.destroy(entity);
+     *
+     *         deferred_entity const loot = commands.create();
+     *         commands.emplace<transform>(loot, position);
+     *         commands.emplace<pickup>(loot);
+     *     }
+     * });
+     *
+     * commands.playback(registry); // the view is not iterated anymore
+     * @endcode
+     *
+     * @note A buffer must not be shared between threads without synchronization, give each thread its own.
+     */
+    class command_buffer final
+    {
+    public:
+        command_buffer( ) noexcept  = default;
+        ~command_buffer( ) noexcept = default;
+
+        command_buffer( command_buffer const& )                        = delete;
+        command_buffer( command_buffer&& ) noexcept                    = default;
+        auto operator=( command_buffer const& ) -> command_buffer&     = delete;
+        auto operator=( command_buffer&& ) noexcept -> command_buffer& = default;
+
+        /**
+         * @brief Records the creation of an entity.
+         * @complexity O(1)
+         * @return A handle to refer to the entity in later commands of this buffer.
+         */
+        [[nodiscard]] auto create( ) noexcept -> deferred_entity;
+
+        /**
+         * @brief Records the destruction of @entity. Destroying a dead or stale handle is a no-op on playback.
+         * @complexity O(1) amortized
+         */
+        auto destroy( entity_type entity ) -> void;
+
+        /**
+         * @brief Records the destruction of an entity created by this buffer.
+         * @complexity O(1) amortized
+         */
+        auto destroy( deferred_entity entity ) -> void;
+
+        /**
+         * @brief Records the addition (or replacement) of a TComponent, constructed now from @args.
+         *
+         * @complexity O(1) amortized, plus the copy of the component into the arena
+         * @tparam TComponent The component type to emplace.
+         * @param entity The entity to attach the component to.
+         * @param args Constructor arguments forwarded to TComponent's constructor.
+         */
+        template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
+        auto emplace( entity_type const entity, TArgs&&... args ) -> void
+        {
+            record_emplace<TComponent>( { entity, false }, std::forward<TArgs>( args )... );
+        }
+
+
+        /**
+         * @brief Records the addition of a TComponent to an entity created by this buffer.
+         *
+         * @complexity O(1) amortized, plus the copy of the component into the arena
+         * @tparam TComponent The component type to emplace.
+         * @param entity The deferred entity to attach the component to.
+         * @param args Constructor arguments forwarded to TComponent's constructor.
+         */
+        template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
+        auto emplace( deferred_entity const entity, TArgs&&... args ) -> void
+        {
+            record_emplace<TComponent>( { entity.id, true }, std::forward<TArgs>( args )... );
+        }
+
+
+        /**
+         * @brief Records the removal of the TComponent of @entity.
+         * @complexity O(1) amortized
+         */
+        template <detail::ecs_component TComponent>
+        auto remove( entity_type const entity ) -> void
+        {
+            record<TComponent>( { entity, false }, command_type::remove, 0U );
+        }
+
+
+        /**
+         * @brief Records the removal of the TComponent of an entity created by this buffer.
+         * @complexity O(1) amortized
+         */
+        template <detail::ecs_component TComponent>
+        auto remove( deferred_entity const entity ) -> void
+        {
+            record<TComponent>( { entity.id, true }, command_type::remove, 0U );
+        }
+
+
+        /**
+         * @brief Applies every recorded command to @registry and empties the buffer, keeping its memory.
+         *
+         * @complexity O(c log c) where c is the number of component commands, plus the registry operations
+         * @param registry The registry to apply the commands to. No view of it may be iterating.
+         */
+        auto playback( registry& registry ) -> void;
+
+        /**
+         * @brief Moves every command of @other to the back of this buffer, as if they had been recorded here, and
+         * empties @other (keeping its memory).
+         *
+         * Lets buffers recorded on different threads be played back together, in a single batched pass. The
+         * deferred entities of @other are renumbered: handles @other gave out must not be used afterwards.
+         *
+         * @complexity O(c + b) where c is the number of commands and b the component bytes of @other
+         * @param other The buffer to take the commands of.
+         */
+        auto append( command_buffer& other ) -> void;
+
+        /**
+         * @brief Drops every recorded command, keeping the memory for the next recording.
+         */
+        auto clear( ) noexcept -> void;
+
+        /**
+         * @return True if nothing was recorded since the last playback or clear.
+         */
+        [[nodiscard]] auto empty( ) const noexcept -> bool;
+
+    private:
+        enum class command_type : uint8_t
+        {
+            emplace,
+            remove
+        };
+
+
+        // either a registry handle or the id of an entity created by this buffer
+        struct target final
+        {
+            entity_type value;
+            bool deferred;
+        };
+
+
+        struct command;
+        using playback_fn = auto ( * )( registry&, std::span<command const>, std::span<std::byte const> ) -> void;
+
+
+        struct command final
+        {
+            playback_fn playback;
+            meta::sequential_index_type component_id;
+            target entity;
+            command_type type;
+            uint32_t payload_offset;
+        };
+
+
+        std::vector<command> commands_{};
+        std::vector<target> destroyed_{};
+        std::vector<std::byte> arena_{};
+        uint32_t created_count_{ 0U };
+
+
+        template <detail::ecs_component TComponent, typename... TArgs>
+        auto record_emplace( target const entity, TArgs&&... args ) -> void
+        {
+            TComponent const component( std::forward<TArgs>( args )... );
+
+            auto const offset = static_cast<uint32_t>( arena_.size( ) );
+            arena_.resize( arena_.size( ) + sizeof( TComponent ) );
+            std::memcpy( arena_.data( ) + offset, &component, sizeof( TComponent ) );
+
+            record<TComponent>( entity, command_type::emplace, offset );
+        }
+
+
+        template <detail::ecs_component TComponent>
+        auto record( target const entity, command_type const type, uint32_t const payload_offset ) -> void
+        {
+            commands_.push_back( {
+                &playback_pool<TComponent>, detail::component_sequence::index_of<TComponent>( ), entity, type, payload_offset
+            } );
+        }
+
+
+        /**
+         * @brief Applies the commands of a single pool, sorted by entity, with one reserve up front.
+         */
+        template <detail::ecs_component TComponent>
+        static auto playback_pool(
+            registry& registry, std::span<command const> const commands, std::span<std::byte const> const arena ) -> void
+        {
+            std::size_t const emplaced = static_cast<std::size_t>( std::ranges::count(
+                commands, command_type::emplace, &command::type ) );
+
+            auto& pool = registry.ensure_pool<TComponent>( );
+            pool.reserve( pool.size( ) + emplaced );
+
+            for ( command const& cmd : commands )
+            {
+                if ( cmd.type == command_type::remove )
+                {
+                    registry.remove<TComponent>( cmd.entity.value );
+                }
+                else if ( registry.alive( cmd.entity.value ) )
+                {
+                    // copied out through bytes: the arena gives no alignment guarantee, and a component need not
+                    // be default constructible
+                    std::array<std::byte, sizeof( TComponent )> bytes;
+                    std::memcpy( bytes.data( ), arena.data( ) + cmd.payload_offset, sizeof( TComponent ) );
+                    registry.emplace<TComponent>( cmd.entity.value, std::bit_cast<TComponent>( bytes ) );
+                }
+            }
+        }
+    };
+}
+
+
+#endif //!RST_ECS_COMMAND_BUFFER_H
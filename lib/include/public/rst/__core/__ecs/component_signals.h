@@ -0,0 +1,48 @@
+#ifndef RST_ECS_COMPONENT_SIGNALS_H
+#define RST_ECS_COMPONENT_SIGNALS_H
+
+#include <rst/pch.h>
+
+#include <rst/data_type/event/multicast_delegate.h>
+#include <rst/__core/__ecs/entity.h>
+
+
+namespace rst::ecs
+{
+    class registry;
+
+
+    /**
+     * @brief Lifecycle listeners of one component type in one registry.
+     *
+     * Created by the registry the first time a listener asks for them (registry::on_construct, on_replace,
+     * on_destroy). Until then the pool has no signals at all and the registry skips them with a single branch,
+     * so component types nobody listens to pay nothing.
+     *
+     * Listeners receive the registry and the entity:
+     * - on_construct, after the component was added to an entity that did not have one;
+     * - on_replace, after the component of an entity was overwritten by emplace;
+     * - on_destroy, before the component is removed, by remove or by the destruction of its entity. The component
+     * can still be read.
+     *
+     * @note Listeners may read and write other components freely, but must not add or remove the component type
+     * they listen to, nor add components to an entity being destroyed.
+     */
+    struct component_signals final
+    {
+        using delegate_type = multicast_delegate<registry&, entity_type>;
+
+        delegate_type on_construct{};
+        delegate_type on_replace{};
+        delegate_type on_destroy{};
+
+        /**
+         * @brief Broadcasts on_replace if @replaced, on_construct otherwise. Out of line, so that emplace only
+         * carries a call for it.
+         */
+        auto broadcast_emplace( registry& registry, entity_type entity, bool replaced ) const -> void;
+    };
+}
+
+
+#endif //!RST_ECS_COMPONENT_SIGNALS_H
@@ -0,0 +1,91 @@
+#ifndef RST_ECS_COMPONENT_TRAITS_H
+#define RST_ECS_COMPONENT_TRAITS_H
+
+#include <rst/pch.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * Registry-wide change tick, see registry::tick. Wraps around, compare ticks with is_newer_tick.
+     */
+    using tick_type = uint32_t;
+
+
+    /**
+     * @brief Per component type storage options, read once when the registry creates the pool.
+     *
+     * Options default to off. A component opts in with a static member of the same name, or by specializing this
+     * template for types it cannot change:
+     *
+     * @code
+     * struct sprite_bounds
+     * {
+     *     static constexpr bool track_changes{ true };
+     *     glm::vec4 rect;
+     * };
+     * @endcode
+     *
+     * - track_changes: the pool stamps each component with the tick it was added and last changed at, so views can
+     * filter with added<T> and changed<T>. Costs two ticks per component and a store per mutable access.
+     * - pointer_stable: a component keeps its address until it is removed, so other components may point to it.
+     * The pool stores the components in fixed-size pages and leaves a tombstone where one is removed, reused by the
+     * next insertion. Views skip the tombstones, the pool cannot be sorted nor owned by a group.
+     *
+     * @tparam TComponent The component type, without cv-qualifiers
+     */
+    template <typename TComponent>
+    struct component_traits
+    {
+        static constexpr bool track_changes = []
+        {
+            if constexpr ( requires { { TComponent::track_changes } -> std::convertible_to<bool>; } )
+            {
+                return static_cast<bool>( TComponent::track_changes );
+            }
+            else
+            {
+                return false;
+            }
+        }( );
+
+        static constexpr bool pointer_stable = []
+        {
+            if constexpr ( requires { { TComponent::pointer_stable } -> std::convertible_to<bool>; } )
+            {
+                return static_cast<bool>( TComponent::pointer_stable );
+            }
+            else
+            {
+                return false;
+            }
+        }( );
+    };
+
+
+    /**
+     * Components whose pool stamps added and changed ticks.
+     */
+    template <typename TComponent>
+    concept change_tracked = component_traits<std::remove_const_t<TComponent>>::track_changes;
+
+
+    /**
+     * Components whose pool never moves them, see component_traits.
+     */
+    template <typename TComponent>
+    concept pointer_stable = component_traits<std::remove_const_t<TComponent>>::pointer_stable;
+
+
+    /**
+     * @return True if @tick is later than @since, correct across wrap-around as long as the two are less than half
+     * the tick range apart
+     */
+    [[nodiscard]] constexpr auto is_newer_tick( tick_type const tick, tick_type const since ) noexcept -> bool
+    {
+        return static_cast<std::make_signed_t<tick_type>>( tick - since ) > 0;
+    }
+}
+
+
+#endif //!RST_ECS_COMPONENT_TRAITS_H
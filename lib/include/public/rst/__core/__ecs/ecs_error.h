@@ -7,6 +7,7 @@ namespace rst::ecs
     enum class ecs_error
     {
         invalid_entity_id, entity_not_found, component_not_found,
+        invalid_snapshot, snapshot_version_mismatch, snapshot_layout_mismatch,
     };
 }
 
@@ -8,6 +8,91 @@ namespace rst::ecs
 {
     using entity_type = uint32_t;
     static constexpr entity_type null_entity{ 0U };
+
+
+    /**
+     * @brief Bit layout of an entity_type handle.
+     *
+     * The low bits address a slot (index) and the high bits count how many times that slot has been recycled
+     * (version). Destroying an entity bumps the version of its slot before the slot is reused, so any handle
+     * still holding the old version no longer compares equal to the live entity and can be rejected in O(1).
+     *
+     * Index 0 is reserved so that null_entity (index 0, version 0) is never handed out, and so is the last index:
+     * its handle at the last version has every bit set, the tombstone of pointer-stable sparse sets.
+     *
+     * @code
+     * entity_type const entity = entity_traits::combine( 42U, 3U );
+     * assert( entity_traits::to_index( entity ) == 42U );
+     * assert( entity_traits::to_version( entity ) == 3U );
+     * @endcode
+     */
+    struct entity_traits final
+    {
+        using value_type   = entity_type;
+        using index_type   = uint32_t;
+        using version_type = uint16_t;
+
+        static constexpr std::size_t index_bits{ 20U };
+        static constexpr std::size_t version_bits{ 12U };
+
+        static constexpr value_type index_mask{ ( value_type{ 1U } << index_bits ) - 1U };
+        static constexpr value_type version_mask{ ( value_type{ 1U } << version_bits ) - 1U };
+
+        // highest index handed out
+        static constexpr index_type max_index{ index_mask - 1U };
+
+        /**
+         * Handles are compared by value in the sparse sets, versioning makes stale handles miss.
+         */
+        static constexpr bool is_versioned{ true };
+
+
+        /**
+         * @param entity The handle to split
+         * @return The slot addressed by @entity
+         */
+        [[nodiscard]] static constexpr auto to_index( value_type const entity ) noexcept -> index_type
+        {
+            return entity & index_mask;
+        }
+
+
+        /**
+         * @param entity The handle to split
+         * @return How many times the slot of @entity had been recycled when @entity was created
+         */
+        [[nodiscard]] static constexpr auto to_version( value_type const entity ) noexcept -> version_type
+        {
+            return static_cast<version_type>( ( entity >> index_bits ) & version_mask );
+        }
+
+
+        /**
+         * @param index The slot, must fit in index_bits
+         * @param version The version, wraps around version_bits
+         * @return The handle made of @index and @version
+         */
+        [[nodiscard]] static constexpr auto combine( index_type const index, version_type const version ) noexcept -> value_type
+        {
+            return ( index & index_mask ) | ( ( static_cast<value_type>( version ) & version_mask ) << index_bits );
+        }
+
+
+        /**
+         * @param version The current version of a slot
+         * @return The version the slot gets once recycled, wrapping around version_bits
+         */
+        [[nodiscard]] static constexpr auto next_version( version_type const version ) noexcept -> version_type
+        {
+            return static_cast<version_type>( ( version + 1U ) & version_mask );
+        }
+    };
+
+
+    static_assert( entity_traits::index_bits + entity_traits::version_bits == std::numeric_limits<entity_type>::digits );
+    static_assert( entity_traits::to_index( null_entity ) == 0U && entity_traits::to_version( null_entity ) == 0U );
+    static_assert(
+        entity_traits::combine( entity_traits::max_index, entity_traits::version_mask ) != std::numeric_limits<entity_type>::max( ) );
 }
 
 
@@ -3,21 +3,57 @@
 
 #include <rst/pch.h>
 
-#include <rst/data_type/token_generator.h>
 #include <rst/data_type/event/multicast_delegate.h>
 #include <rst/__core/__ecs/entity.h>
 
 
 namespace rst::ecs
 {
+    class snapshot;
+
+
+    /**
+     * @brief Issues generational entity handles and recycles the slots of destroyed ones.
+     *
+     * Every handle is an index plus a version (see entity_traits). Destroyed indices go to a free list and are
+     * handed out again with a bumped version, so the index range (and with it every pool's sparse array) stays
+     * bounded by the peak number of live entities rather than by the number of entities ever created.
+     *
+     * @code
+     * entity_allocator alloc{};
+     *
+     * entity_type const bullet = alloc.create( );
+     * alloc.destroy( bullet );
+     *
+     * entity_type const reused = alloc.create( ); // same index, next version
+     * assert( not alloc.alive( bullet ) && alloc.alive( reused ) );
+     *
+     * // bulk operations broadcast once per batch, on the on_batch_* delegates
+     * std::span<entity_type const> const wave = alloc.create( 10'000 );
+     * alloc.destroy( wave );
+     * @endcode
+     *
+     * @note A slot's version wraps after 2^version_bits recycles, at which point a very old handle would alias a
+     * live one again.
+     */
     class entity_allocator final
     {
+        friend class snapshot;
+
     public:
         multicast_delegate<entity_type> on_creation{};
         multicast_delegate<entity_type> on_destruction{};
         multicast_delegate<> on_clear{};
 
+        multicast_delegate<std::span<entity_type const>> on_batch_creation{};
+        multicast_delegate<std::span<entity_type const>> on_batch_destruction{};
+
         entity_allocator( );
+
+        /**
+         * @param resource Where the slots and the free list are allocated from, must outlive the allocator.
+         */
+        explicit entity_allocator( std::pmr::memory_resource* resource );
         ~entity_allocator( ) noexcept = default;
 
         entity_allocator( entity_allocator const& )                        = delete;
@@ -25,12 +61,71 @@ namespace rst::ecs
         auto operator=( entity_allocator const& ) -> entity_allocator&     = delete;
         auto operator=( entity_allocator&& ) noexcept -> entity_allocator& = delete;
 
+        /**
+         * @brief Creates an entity, reusing the most recently freed index if any.
+         * @complexity O(1) amortized
+         * @return The new entity, or null_entity if every index is in use.
+         */
         auto create( ) -> entity_type;
+
+        /**
+         * @brief Creates @count entities at once, with a single on_batch_creation broadcast (on_creation is not
+         * broadcast for them).
+         * @complexity O(n) where n is @count
+         * @param count The number of entities to create.
+         * @return The new entities, fewer than @count if the index space ran out. The span stays valid until the
+         * next bulk create.
+         */
+        auto create( std::size_t count ) -> std::span<entity_type const>;
+
+        /**
+         * @brief Broadcasts the destruction of @entity and frees its index for reuse with the next version.
+         * Stale or null handles are ignored, so a double destroy never reaches the pools.
+         * @complexity O(1) plus the on_destruction listeners
+         * @param entity The entity to destroy.
+         */
         auto destroy( entity_type entity ) -> void;
+
+        /**
+         * @brief Destroys every live entity of @entities, with a single on_batch_destruction broadcast (on_destruction
+         * is not broadcast for them). Stale, null and duplicate handles are skipped.
+         * @complexity O(n) where n is the number of handles, plus the on_batch_destruction listeners
+         * @param entities The entities to destroy, in any order. May be the span returned by a bulk create.
+         */
+        auto destroy( std::span<entity_type const> entities ) -> void;
+
+        /**
+         * @brief Destroys every entity at once. Outstanding handles all become stale, once the on_clear listeners
+         * returned.
+         * @complexity O(n) where n is the number of slots ever used
+         */
         auto clear( ) -> void;
 
+        /**
+         * @complexity O(1)
+         * @param entity The handle to check.
+         * @return True if @entity was created by this allocator and not destroyed since.
+         */
+        [[nodiscard]] auto alive( entity_type entity ) const noexcept -> bool;
+
+        /**
+         * @return Number of live entities.
+         */
+        [[nodiscard]] auto alive_count( ) const noexcept -> std::size_t;
+
     private:
-        token_generator<entity_type, null_entity> token_gen_{};
+        // slot i holds the live handle with index i, or null_entity while the index is free
+        std::pmr::vector<entity_type> slots_;
+
+        // handles ready to be issued for the free indices, the version already bumped
+        std::pmr::vector<entity_type> free_handles_;
+
+        // storage of the last bulk create, and scratch space of bulk destroys
+        std::pmr::vector<entity_type> created_batch_;
+        std::pmr::vector<entity_type> destroyed_batch_;
+
+
+        auto release( entity_traits::index_type index ) -> void;
     };
 }
 
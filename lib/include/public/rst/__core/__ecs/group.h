@@ -0,0 +1,305 @@
+#ifndef RST_ECS_GROUP_H
+#define RST_ECS_GROUP_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_index.h>
+#include <rst/meta/type_traits.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    namespace detail
+    {
+        /**
+         * @brief Type-erased bookkeeping of an owning group.
+         *
+         * Keeps every entity that has all the owned components packed at the front of each owned pool, in the
+         * same order in every pool. The registry forwards component additions and removals on owned pools here,
+         * before the removal and after the addition.
+         */
+        class group_handler final
+        {
+        public:
+            group_handler( std::vector<base_reg_pool_type*> pools, std::vector<meta::sequential_index_type> component_ids );
+            ~group_handler( ) noexcept = default;
+
+            group_handler( group_handler const& )                        = delete;
+            group_handler( group_handler&& ) noexcept                    = delete;
+            auto operator=( group_handler const& ) -> group_handler&     = delete;
+            auto operator=( group_handler&& ) noexcept -> group_handler& = delete;
+
+            /**
+             * @brief Moves @entity into the group if it now owns every component and is not in it yet.
+             * @complexity O(k) where k is the number of owned pools
+             */
+            auto on_emplace( entity_type entity ) -> void;
+
+            /**
+             * @brief Moves @entity out of the group if it is in it. Must run before the component is removed.
+             * @complexity O(k) where k is the number of owned pools
+             */
+            auto on_remove( entity_type entity ) -> void;
+
+            /**
+             * @brief Empties the group, to be called when every owned pool is cleared.
+             */
+            auto on_clear( ) noexcept -> void;
+
+            /**
+             * @brief Rebuilds the group from scratch, to be called when the owned pools were filled in bulk.
+             * @complexity O(n) where n is the size of the smallest owned pool
+             */
+            auto regroup( ) -> void;
+
+            /**
+             * @param component_ids Component ids, in any order
+             * @return True if this group owns exactly the components in @component_ids
+             */
+            [[nodiscard]] auto owns( std::span<meta::sequential_index_type const> component_ids ) const -> bool;
+
+            /**
+             * @return Number of entities packed at the front of the owned pools
+             */
+            [[nodiscard]] auto size( ) const noexcept -> std::size_t;
+
+        private:
+            std::vector<base_reg_pool_type*> const pools_;
+            std::vector<meta::sequential_index_type> component_ids_; // sorted
+            std::size_t size_{ 0U };
+        };
+    }
+
+
+    /**
+     * @brief A handle to an owning group, the entities that have all of TOwned packed in lockstep.
+     *
+     * Owned pools keep the group's entities at the front of their dense arrays, in identical order, so iterating
+     * the group is a linear walk over parallel arrays: no pivot choice and no membership test. The registry
+     * maintains the layout on emplace, remove and entity destruction.
+     *
+     * @code
+     * auto movement = registry.group<position, velocity>();
+     *
+     * movement.each([](position& pos, velocity const& vel) {
+     *     pos.x += vel.dx;
+     *     pos.y += vel.dy;
+     * });
+     *
+     * // or straight over the parallel arrays
+     * movement.each_chunk([](std::span<position> positions, std::span<velocity> velocities) {
+     *     // same length, same entity at the same position
+     * });
+     * @endcode
+     *
+     * @note A component can be owned by one group only. Owned pools must not be reordered by anyone else.
+     * @note Pointer-stable components, transform among them, cannot be owned: queries over them stay on views.
+     * @note Adding or removing owned components while iterating reorders the group, do that after the loop.
+     * @note Owned tags (empty component types) have no array, each_chunk hands them out from a shared buffer, in
+     * windows of at most sparse_set::tag_span_capacity entities.
+     *
+     * @tparam TOwned The owned component types.
+     */
+    template <detail::ecs_component... TOwned> requires ( sizeof...( TOwned ) > 1U )
+    class group final
+    {
+    public:
+        /**
+         * @brief Constructs a group handle. Use registry::group to get one.
+         *
+         * @complexity O(1)
+         */
+        explicit group( detail::group_handler const& handler, detail::reg_pool_type<TOwned>&... pools ) noexcept
+            : handler_ref_{ handler }
+            , pools_{ pools... } { }
+
+
+        /**
+         * @return Number of entities in the group.
+         */
+        [[nodiscard]] auto size( ) const noexcept -> std::size_t { return handler_ref_.size( ); }
+
+
+        /**
+         * @return True if no entity owns every component.
+         */
+        [[nodiscard]] auto empty( ) const noexcept -> bool { return size( ) == 0U; }
+
+
+        /**
+         * @return The entities of the group, in iteration order.
+         */
+        [[nodiscard]] auto entities( ) const noexcept -> std::span<entity_type const>
+        {
+            return std::get<0U>( pools_ ).packed( ).first( size( ) );
+        }
+
+
+        /**
+         * @tparam TComponent An owned component type, not a tag.
+         * @return The TComponent of every entity in the group, aligned with entities().
+         */
+        template <meta::contains_type<TOwned...> TComponent> requires ( not detail::reg_pool_type<TComponent>::is_tag_set )
+        [[nodiscard]] auto data( ) const noexcept -> std::span<TComponent>
+        {
+            return std::get<meta::index_of_v<TComponent, TOwned...>>( pools_ ).data( ).first( size( ) );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity of the group with its components.
+         *
+         * @tparam TDelegate Function type that accepts (entity_type, TOwned&...).
+         * @param delegate Function to apply to each entity and its components.
+         *
+         * @complexity O(n) where n is the size of the group.
+         */
+        template <std::invocable<entity_type, TOwned&...> TDelegate>
+        auto each( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+        {
+            auto const entities = this->entities( );
+            std::tuple<std::span<TOwned>...> const arrays{ column<TOwned>( )... };
+            for ( std::size_t pos = 0U; pos < entities.size( ); ++pos )
+            {
+                delegate( entities[pos], at( std::get<std::span<TOwned>>( arrays ), pos )... );
+            }
+        }
+
+
+        /**
+         * @brief Applies a function to the components of each entity of the group.
+         *
+         * @tparam TDelegate Function type that accepts (TOwned&...).
+         * @param delegate Function to apply to each entity's components.
+         *
+         * @complexity O(n) where n is the size of the group.
+         */
+        template <std::invocable<TOwned&...> TDelegate>
+        auto each( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+        {
+            std::size_t const size = this->size( );
+            std::tuple<std::span<TOwned>...> const arrays{ column<TOwned>( )... };
+            for ( std::size_t pos = 0U; pos < size; ++pos )
+            {
+                delegate( at( std::get<std::span<TOwned>>( arrays ), pos )... );
+            }
+        }
+
+
+        /**
+         * @brief Hands the whole group to a function as parallel spans.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<entity_type const>, std::span<TOwned>...).
+         * @param delegate Function to call once with the group's arrays.
+         *
+         * @complexity O(1) plus the delegate.
+         */
+        template <std::invocable<std::span<entity_type const>, std::span<TOwned>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+        {
+            if constexpr ( not owns_tags_ )
+            {
+                delegate( entities( ), data<TOwned>( )... );
+            }
+            else
+            {
+                auto const entities = this->entities( );
+                for ( std::size_t first = 0U; first < entities.size( ); first += window_length_ )
+                {
+                    std::size_t const count = std::min( window_length_, entities.size( ) - first );
+                    delegate( entities.subspan( first, count ), window<TOwned>( first, count )... );
+                }
+            }
+        }
+
+
+        /**
+         * @brief Hands the group's components to a function as parallel spans.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<TOwned>...).
+         * @param delegate Function to call once with the group's arrays.
+         *
+         * @complexity O(1) plus the delegate.
+         */
+        template <std::invocable<std::span<TOwned>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+        {
+            if constexpr ( not owns_tags_ )
+            {
+                delegate( data<TOwned>( )... );
+            }
+            else
+            {
+                std::size_t const size = this->size( );
+                for ( std::size_t first = 0U; first < size; first += window_length_ )
+                {
+                    delegate( window<TOwned>( first, std::min( window_length_, size - first ) )... );
+                }
+            }
+        }
+
+    private:
+        static constexpr bool owns_tags_{ ( detail::reg_pool_type<TOwned>::is_tag_set || ... ) };
+
+        // tags bound the spans each_chunk can hand out at once
+        static constexpr std::size_t window_length_{
+            std::min( {
+                ( detail::reg_pool_type<TOwned>::is_tag_set
+                      ? detail::reg_pool_type<TOwned>::tag_span_capacity
+                      : std::numeric_limits<std::size_t>::max( ) )...
+            } )
+        };
+
+        detail::group_handler const& handler_ref_;
+        std::tuple<detail::reg_pool_type<TOwned>&...> const pools_;
+
+
+        // the array of TComponent, a single shared instance for tags
+        template <typename TComponent>
+        [[nodiscard]] auto column( ) const noexcept -> std::span<TComponent>
+        {
+            if constexpr ( detail::reg_pool_type<TComponent>::is_tag_set )
+            {
+                return detail::reg_pool_type<TComponent>::tag_span( 1U );
+            }
+            else
+            {
+                return data<TComponent>( );
+            }
+        }
+
+
+        template <typename TComponent>
+        [[nodiscard]] static auto at( std::span<TComponent> const column, std::size_t const pos ) noexcept -> TComponent&
+        {
+            if constexpr ( std::is_empty_v<TComponent> )
+            {
+                return column.front( );
+            }
+            else
+            {
+                return column[pos];
+            }
+        }
+
+
+        template <typename TComponent>
+        [[nodiscard]] auto window( std::size_t const first, std::size_t const count ) const noexcept -> std::span<TComponent>
+        {
+            if constexpr ( detail::reg_pool_type<TComponent>::is_tag_set )
+            {
+                return detail::reg_pool_type<TComponent>::tag_span( count );
+            }
+            else
+            {
+                return data<TComponent>( ).subspan( first, count );
+            }
+        }
+    };
+}
+
+
+#endif //!RST_ECS_GROUP_H
@@ -0,0 +1,170 @@
+#ifndef RST_ECS_PREFAB_H
+#define RST_ECS_PREFAB_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_index.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/registry.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief Entity template: a set of component values captured once and stamped out on as many entities as needed.
+     *
+     * Components are trivially copyable, so the prefab keeps each value as raw bytes in a single arena. Instantiating
+     * creates the entities in bulk, then every pool is reserved once and gets one contiguous fill with the captured
+     * value, instead of an insert_or_replace per entity and component. Groups and signals still see every entity.
+     *
+     * @code
+     * prefab spark{};
+     * spark.set<transform>( origin ).set<velocity>( 0.f, 40.f ).set<particle_tag>( );
+     *
+     * std::span<entity_type const> const sparks = spark.instantiate( registry, 2'000 );
+     * registry.emplace_n<velocity>( sparks, random_velocities ); // per-entity tweaks on top
+     * @endcode
+     *
+     * @note The prefab copies values at set( ) time, later changes to the source objects are not seen.
+     */
+    class prefab final
+    {
+    public:
+        prefab( ) noexcept  = default;
+        ~prefab( ) noexcept = default;
+
+        prefab( prefab const& )                        = default;
+        prefab( prefab&& ) noexcept                    = default;
+        auto operator=( prefab const& ) -> prefab&     = default;
+        auto operator=( prefab&& ) noexcept -> prefab& = default;
+
+        /**
+         * @brief Captures a TComponent constructed from @args, replacing the prefab's previous TComponent if any.
+         *
+         * @complexity O(c) where c is the number of components in the prefab, plus the copy of the component
+         * @tparam TComponent The component type to capture.
+         * @param args Constructor arguments forwarded to TComponent's constructor.
+         * @return This prefab, to chain calls.
+         */
+        template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
+        auto set( TArgs&&... args ) -> prefab&
+        {
+            TComponent const component( std::forward<TArgs>( args )... );
+
+            component_entry* entry = find( detail::component_sequence::index_of<TComponent>( ) );
+            if ( entry == nullptr )
+            {
+                entry = &components_.emplace_back( component_entry{
+                    &instantiate_pool<TComponent>, detail::component_sequence::index_of<TComponent>( ),
+                    static_cast<uint32_t>( arena_.size( ) ) } );
+                arena_.resize( arena_.size( ) + sizeof( TComponent ) );
+            }
+            std::memcpy( arena_.data( ) + entry->payload_offset, &component, sizeof( TComponent ) );
+            return *this;
+        }
+
+
+        /**
+         * @brief Drops the prefab's TComponent, if any. Its bytes stay in the arena until the prefab is cleared.
+         * @complexity O(c) where c is the number of components in the prefab
+         * @return This prefab, to chain calls.
+         */
+        template <detail::ecs_component TComponent>
+        auto remove( ) -> prefab&
+        {
+            std::erase_if( components_, [id = detail::component_sequence::index_of<TComponent>( )]( component_entry const& entry )
+            {
+                return entry.component_id == id;
+            } );
+            return *this;
+        }
+
+
+        /**
+         * @complexity O(c) where c is the number of components in the prefab
+         * @return True if the prefab holds a TComponent.
+         */
+        template <detail::viewable_ecs_component TComponent>
+        [[nodiscard]] auto has( ) const noexcept -> bool
+        {
+            return std::ranges::find(
+                       components_, detail::component_sequence::index_of<std::remove_const_t<TComponent>>( ),
+                       &component_entry::component_id ) != components_.end( );
+        }
+
+
+        /**
+         * @brief Creates @count entities holding a copy of every component of the prefab.
+         *
+         * Entities are created with a single on_batch_creation broadcast, then each pool gets them all in one
+         * append. Components are added in the order they were first set.
+         *
+         * @complexity O(c + n * c) where c is the number of components, a fill per pool rather than an insertion per
+         * entity, plus the groups and listeners of the pools
+         * @param registry The registry to create the entities in.
+         * @param count The number of entities to create.
+         * @return The new entities, fewer than @count if the index space ran out. The span stays valid until the
+         * next bulk create on the registry.
+         * @note A listener may emplace a component of the prefab on the new entities before its pool is filled:
+         * that pool then falls back to an emplace per entity, and the prefab's value replaces the listener's.
+         */
+        auto instantiate( registry& registry, std::size_t count ) const -> std::span<entity_type const>;
+
+        /**
+         * @brief Creates one entity holding a copy of every component of the prefab.
+         * @complexity O(c) where c is the number of components in the prefab
+         * @return The new entity, or null_entity if every index is in use.
+         */
+        auto instantiate( registry& registry ) const -> entity_type;
+
+        /**
+         * @brief Drops every component, keeping the memory.
+         */
+        auto clear( ) noexcept -> void;
+
+        /**
+         * @return Number of components in the prefab.
+         */
+        [[nodiscard]] auto size( ) const noexcept -> std::size_t;
+
+        /**
+         * @return True if the prefab holds no component.
+         */
+        [[nodiscard]] auto empty( ) const noexcept -> bool;
+
+    private:
+        using instantiate_fn = auto ( * )( registry&, std::span<entity_type const>, std::byte const* ) -> void;
+
+
+        struct component_entry final
+        {
+            instantiate_fn instantiate;
+            meta::sequential_index_type component_id;
+            uint32_t payload_offset;
+        };
+
+
+        std::vector<component_entry> components_{};
+        std::vector<std::byte> arena_{};
+
+
+        [[nodiscard]] auto find( meta::sequential_index_type component_id ) noexcept -> component_entry*;
+
+
+        template <detail::ecs_component TComponent>
+        static auto instantiate_pool(
+            registry& registry, std::span<entity_type const> const entities, std::byte const* const payload ) -> void
+        {
+            // the arena gives no alignment guarantee, the value is copied out once for the whole batch, through bytes
+            // since a component need not be default constructible
+            std::array<std::byte, sizeof( TComponent )> bytes;
+            std::memcpy( bytes.data( ), payload, sizeof( TComponent ) );
+            registry.append_fresh<TComponent>( entities, std::bit_cast<TComponent>( bytes ) );
+        }
+    };
+}
+
+
+#endif //!RST_ECS_PREFAB_H
@@ -3,18 +3,29 @@
 
 #include <rst/pch.h>
 
+#include <rst/diagnostic.h>
 #include <rst/data_type/sparse_set.h>
 #include <rst/data_type/unique_ref.h>
+#include <rst/meta/hash.h>
 #include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/component_signals.h>
+#include <rst/__core/__ecs/component_traits.h>
 #include <rst/__core/__ecs/entity.h>
 #include <rst/__core/__ecs/entity_allocator.h>
+#include <rst/__core/__ecs/group.h>
 #include <rst/__core/__ecs/registry_pool.h>
+#include <rst/__core/__ecs/runtime_view.h>
+#include <rst/__core/__ecs/signature_table.h>
 #include <rst/__core/__ecs/view.h>
 
 
-// todo: add event system for entity/component lifecycle (on_construct, on_destroy, on_update, etc)
 namespace rst::ecs
 {
+    class command_buffer;
+    class prefab;
+    class snapshot;
+
+
     /**
      * @brief Central coordinator for the Entity Component System (ECS) managing entities, components, and their relationships.
      *
@@ -24,8 +35,24 @@ namespace rst::ecs
      *
      * Key features:
      * - Entity lifecycle management with automatic cleanup
+     * - Generational entity handles, stale handles are rejected in O(1)
      * - Type-safe component operations with compile-time checks
      * - Efficient component storage using sparse sets
+     * - Pools addressed by a dense component id, one indexed load per lookup
+     * - Owning groups keeping hot component sets packed in lockstep
+     * - Per-entity component signatures, destruction only visits the pools an entity is in
+     * - Bulk creation, emplacement and destruction, batched per pool with a single notification
+     * - Per-component construct, replace and destroy signals, free for component types nobody listens to
+     * - Opt-in added and changed ticks per component type, for views filtering with added<T> and changed<T>
+     * - Runtime views over component types chosen by hash, for tools and scripting (see runtime_view)
+     * - In-place pool sorting, so that views led by a pool visit its entities in a chosen order
+     * - Tag components (empty types) cost the entity arrays only, no component storage
+     * - Opt-in pointer-stable pools, for components other components hold pointers to
+     * - Deferred structural changes through command_buffer, batched per pool on playback
+     * - Binary snapshots of the entities and chosen pools, restored with bulk copies (see snapshot)
+     * - Prefabs stamping out many identical entities with one append per pool (see prefab)
+     * - Storage allocated from a std::pmr::memory_resource of choice (e.g. a level arena), counted per pool
+     * - Per-pool memory report, and compaction giving peak capacity back between levels (see compact)
      * - Automatic memory management with RAII principles
      * - Event-driven entity destruction for consistency
      * - Template-based API for zero-cost abstractions
@@ -65,14 +92,43 @@ namespace rst::ecs
      * 
      * // entity destruction automatically removes all components
      * registry.entity_alloc().destroy(entity1);
+     *
+     * // the destroyed handle is stale, even once its index is reused
+     * auto entity3 = registry.entity_alloc().create();
+     * assert(not registry.alive(entity1) && not registry.has<position>(entity1));
      * @endcode
      */
     class registry final
     {
+        friend class command_buffer;
+        friend class prefab;
+        friend class snapshot;
+
     public:
-        registry( )
+        registry( ) : registry{ std::pmr::get_default_resource( ) } { }
+
+        /**
+         * @brief Constructs a registry allocating its pools, the arrays of every pool, the entity slots and the
+         * signatures from @resource.
+         *
+         * Pairs with memory::monotonic_arena for level-scoped worlds: the level is loaded into a registry on the
+         * arena and unloaded by destroying the registry, then resetting or destroying the arena.
+         *
+         * @param resource Where the registry storage comes from, must outlive the registry.
+         */
+        explicit registry( std::pmr::memory_resource* const resource )
+            : resource_ptr_{ resource }
+            , pools_{ resource }
+            , hooks_{ resource }
+            , pool_keys_{ resource }
+            , signatures_{ resource }
+            , batch_removals_{ resource }
+            , batch_offsets_{ resource }
+            , batch_buckets_{ resource }
+            , entity_alloc_{ resource }
         {
             entity_alloc_.on_destruction.bind( this, &registry::destroy_entity );
+            entity_alloc_.on_batch_destruction.bind( this, &registry::destroy_entities );
             entity_alloc_.on_clear.bind( this, &registry::clear_entities );
         }
 
@@ -96,6 +152,19 @@ namespace rst::ecs
         }
 
 
+        /**
+         * @brief Checks whether a handle refers to a live entity.
+         *
+         * @complexity O(1)
+         * @param entity The handle to check.
+         * @return True if the entity was created and not destroyed since, false for stale or null handles.
+         */
+        [[nodiscard]] auto alive( entity_type const entity ) const noexcept -> bool
+        {
+            return entity_alloc_.alive( entity );
+        }
+
+
         /**
          * @brief Constructs a component of type TComponent for the given entity in-place.
          * 
@@ -108,11 +177,64 @@ namespace rst::ecs
          * @param entity The entity to attach the component to.
          * @param args Constructor arguments forwarded to TComponent's constructor.
          * @return Reference to the newly created component.
+         *
+         * @note The entity must be alive, emplacing on a stale handle asserts.
          */
         template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
         auto emplace( entity_type const entity, TArgs&&... args ) -> TComponent&
         {
-            return ensure_pool<TComponent>( ).insert_or_replace( entity, std::forward<TArgs>( args )... );
+            ensure( alive( entity ), "emplace on a dead or stale entity!" );
+            auto& pool            = ensure_pool<TComponent>( );
+            TComponent& component = pool.insert_or_replace( entity, std::forward<TArgs>( args )... );
+            bool const replaced   = signatures_.set( entity_traits::to_index( entity ), component_index<TComponent>( ) );
+
+            if ( detail::pool_hooks const hooks = hooks_[component_index<TComponent>( )]; not hooks.empty( ) )
+            {
+                return run_emplace_hooks<TComponent>( pool, hooks, entity, replaced );
+            }
+            return component;
+        }
+
+
+        /**
+         * @brief Gives every entity of @entities a copy of @value, replacing the components they already had.
+         *
+         * The pool is looked up and reserved once, the new components are appended contiguously.
+         *
+         * @complexity O(n) where n is the number of entities
+         * @tparam TComponent Non-const, non-reference type of the component to emplace.
+         * @param entities The entities to attach the component to, e.g. the span returned by a bulk create.
+         * @param value The component to copy.
+         *
+         * @note The entities must be alive, emplacing on a stale handle asserts.
+         */
+        template <detail::ecs_component TComponent>
+        auto emplace_n( std::span<entity_type const> const entities, TComponent const& value ) -> void
+        {
+            emplace_batch<TComponent>( entities, [&value]( std::size_t ) -> TComponent const& { return value; } );
+        }
+
+
+        /**
+         * @brief Gives the i-th entity of @entities the i-th component of @values, replacing the components they
+         * already had.
+         *
+         * The pool is looked up and reserved once, the new components are appended contiguously.
+         *
+         * @complexity O(n) where n is the number of entities
+         * @tparam TComponent Non-const, non-reference type of the component to emplace.
+         * @param entities The entities to attach the components to, e.g. the span returned by a bulk create.
+         * @param values The components to copy, at least as many as @entities.
+         *
+         * @note The entities must be alive, emplacing on a stale handle asserts.
+         */
+        template <detail::ecs_component TComponent, std::ranges::random_access_range TRange>
+            requires std::convertible_to<std::ranges::range_reference_t<TRange>, TComponent const&>
+        auto emplace_n( std::span<entity_type const> const entities, TRange&& values ) -> void
+        {
+            ensure( std::ranges::size( values ) >= entities.size( ), "emplace_n: fewer values than entities!" );
+            emplace_batch<TComponent>(
+                entities, [it = std::ranges::begin( values )]( std::size_t const i ) -> TComponent const& { return it[i]; } );
         }
 
 
@@ -129,7 +251,20 @@ namespace rst::ecs
         template <detail::ecs_component TComponent>
         auto remove( entity_type const entity ) -> void
         {
-            ensure_pool<TComponent>( ).remove( entity );
+            // a stale handle must not clear the row of the entity now living at its index
+            if ( not alive( entity ) ) { return; }
+
+            auto& pool = ensure_pool<TComponent>( );
+            if ( detail::pool_hooks const hooks = hooks_[component_index<TComponent>( )]; not hooks.empty( ) )
+            {
+                if ( hooks.signals != nullptr && has<TComponent>( entity ) )
+                {
+                    hooks.signals->on_destroy.broadcast( *this, entity );
+                }
+                if ( hooks.owner != nullptr ) { hooks.owner->on_remove( entity ); }
+            }
+            signatures_.reset( entity_traits::to_index( entity ), component_index<TComponent>( ) );
+            pool.remove( entity );
         }
 
 
@@ -139,15 +274,137 @@ namespace rst::ecs
          * Uses logical AND to check multiple components - returns true only if
          * the entity has ALL the specified components.
          *
-         * @complexity O(k) where k is the number of component types
+         * @complexity O(k) where k is the number of component types, one bit test each
          * @tparam TComponents The component types to check for.
          * @param entity The entity to check.
-         * @return True if the entity has all specified components, false otherwise.
+         * @return True if the entity has all specified components, false otherwise. Always false for stale handles.
          */
         template <detail::viewable_ecs_component... TComponents>
         [[nodiscard]] auto has( entity_type const entity ) const -> bool
         {
-            return ( has_impl<TComponents>( entity ) && ... );
+            entity_traits::index_type const index = entity_traits::to_index( entity );
+            return alive( entity ) && ( signatures_.test( index, component_index<TComponents>( ) ) && ... );
+        }
+
+
+        /**
+         * @brief Creates the pools of TComponents if they do not exist yet.
+         *
+         * Once a pool exists, views and lookups on it only read the registry's pool table, so systems running on
+         * different threads can create views concurrently as long as every pool they touch was prepared first.
+         *
+         * @complexity O(k) where k is the number of component types
+         * @tparam TComponents The component types whose pools to create.
+         */
+        template <detail::viewable_ecs_component... TComponents>
+        auto prepare( ) -> void
+        {
+            ( static_cast<void>( ensure_pool<TComponents>( ) ), ... );
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @return True if a group owns the TComponent pool, which then keeps the group's order (see sort).
+         */
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] auto is_owned( ) const noexcept -> bool
+        {
+            std::size_t const id = component_index<TComponent>( );
+            return id < hooks_.size( ) && hooks_[id].owner != nullptr;
+        }
+
+
+        /**
+         * @brief Sorts the TComponent pool in place, views led by it then visit the entities in @compare order.
+         *
+         * @code
+         * registry.sort<pelt_frame>( []( pelt_frame const& lhs, pelt_frame const& rhs ) { return lhs.z_index < rhs.z_index; } );
+         * @endcode
+         *
+         * @complexity O(n) if nearly sorted, O(n log n) otherwise, see sparse_set::sort
+         * @tparam TComponent The component type whose pool to sort.
+         * @param compare Strict weak ordering over TComponent.
+         * @note A pool owned by a group keeps the group's order, sorting it throws. References to TComponent
+         * obtained before the call are invalidated, pointer-stable components cannot be sorted.
+         */
+        template <detail::ecs_component TComponent, typename TCompare>
+            requires ( std::strict_weak_order<TCompare&, TComponent const&, TComponent const&> && not pointer_stable<TComponent> )
+        auto sort( TCompare compare ) -> void
+        {
+            auto& pool = ensure_pool<TComponent>( );
+            if ( hooks_[component_index<TComponent>( )].owner != nullptr )
+            {
+                startle( "registry::sort: the pool is owned by a group!" );
+            }
+            pool.sort( std::move( compare ) );
+        }
+
+
+        /**
+         * @brief Reorders the TComponent pool to follow the TOrder pool: the entities having both come first, in
+         * TOrder's order, so that iterating the two together walks both pools sequentially.
+         *
+         * @complexity O(m) where m is the size of the TOrder pool
+         * @tparam TComponent The component type whose pool to reorder.
+         * @tparam TOrder The component type whose pool gives the order.
+         * @note A pool owned by a group keeps the group's order, reordering it throws. References to TComponent
+         * obtained before the call are invalidated, pointer-stable components cannot be reordered.
+         */
+        template <detail::ecs_component TComponent, detail::ecs_component TOrder>
+            requires ( not std::same_as<TComponent, TOrder> && not pointer_stable<TComponent> )
+        auto sort_as( ) -> void
+        {
+            auto& pool = ensure_pool<TComponent>( );
+            if ( hooks_[component_index<TComponent>( )].owner != nullptr )
+            {
+                startle( "registry::sort_as: the pool is owned by a group!" );
+            }
+            pool.sort_as( ensure_pool<TOrder>( ) );
+        }
+
+
+        /**
+         * @brief Listeners called after a TComponent is added to an entity that did not have one.
+         *
+         * @code
+         * registry.on_construct<collider>( ).bind( &index, &spatial_index::insert );
+         * @endcode
+         *
+         * @complexity O(1)
+         * @tparam TComponent The component type to listen to.
+         * @return The delegate of TComponent in this registry, see component_signals for the rules listeners follow.
+         */
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] auto on_construct( ) -> component_signals::delegate_type&
+        {
+            return ensure_signals<TComponent>( ).on_construct;
+        }
+
+
+        /**
+         * @brief Listeners called after emplace overwrites the TComponent of an entity.
+         * @complexity O(1)
+         * @tparam TComponent The component type to listen to.
+         * @return The delegate of TComponent in this registry, see component_signals for the rules listeners follow.
+         */
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] auto on_replace( ) -> component_signals::delegate_type&
+        {
+            return ensure_signals<TComponent>( ).on_replace;
+        }
+
+
+        /**
+         * @brief Listeners called before a TComponent is removed, on its own or with its entity.
+         * @complexity O(1)
+         * @tparam TComponent The component type to listen to.
+         * @return The delegate of TComponent in this registry, see component_signals for the rules listeners follow.
+         */
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] auto on_destroy( ) -> component_signals::delegate_type&
+        {
+            return ensure_signals<TComponent>( ).on_destroy;
         }
 
 
@@ -158,18 +415,287 @@ namespace rst::ecs
          * component types. The view uses sparse set intersection for optimal performance.
          *
          * @complexity O(1) - view creation is lightweight, iteration cost depends on entity count.
-         * @tparam TComponents The component types that entities must have.
+         * @tparam TArguments The component types that entities must have, and optionally optional<T>, filters and
+         * exclude<T...>.
+         * @return A view object for iterating over matching entities. Filters match every component added or
+         * changed since the registry was created.
+         */
+        template <detail::view_argument... TArguments>
+        [[nodiscard]] auto view( ) -> ecs::view<TArguments...>
+        {
+            return make_view<ecs::view<TArguments...>>( 0U );
+        }
+
+
+        /**
+         * @brief Creates a view whose added<T> and changed<T> filters match the components stamped after @since.
+         *
+         * @code
+         * // in a system's tick, only the transforms written since the system last ran
+         * registry.view<transform const, changed<transform>>( last_run_tick( ) );
+         * @endcode
+         *
+         * @complexity O(1)
+         * @tparam TArguments The component types that entities must have, and the filters.
+         * @param since Tick after which additions and changes count, usually the last tick the caller ran at.
          * @return A view object for iterating over matching entities.
          */
-        template <detail::viewable_ecs_component... TComponents>
-        [[nodiscard]] auto view( ) -> view<TComponents...>
+        template <detail::view_argument... TArguments> requires ( detail::tick_filter<TArguments> || ... )
+        [[nodiscard]] auto view( tick_type const since ) -> ecs::view<TArguments...>
+        {
+            return make_view<ecs::view<TArguments...>>( since );
+        }
+
+
+        /**
+         * @brief Creates a view over the component types whose meta::hash::type_hash_v are in @components.
+         *
+         * For callers that pick the components at runtime, e.g. an editor or a script bridge. The view intersects
+         * the pools like view does, see runtime_view.
+         *
+         * @code
+         * std::array const components{ meta::hash::type_hash_v<transform>, meta::hash::type_hash_v<velocity> };
+         * registry.runtime_view( components ).each( inspect );
+         * @endcode
+         *
+         * @complexity O(k log p) where k is the number of hashes and p the number of component types the registry saw
+         * @param components The type hashes of the components the entities must have, in the order the view hands
+         * them out.
+         * @param excluded The type hashes of the components the entities must not have.
+         * @return The view, empty if a hash in @components matches no component type the registry saw.
+         */
+        [[nodiscard]] auto runtime_view(
+            std::span<meta::hash::hash_type const> const components,
+            std::span<meta::hash::hash_type const> const excluded = { } ) -> ecs::runtime_view
+        {
+            std::vector<detail::base_reg_pool_type*> pools( components.size( ) );
+            std::vector<detail::base_reg_pool_type*> excluded_pools( excluded.size( ) );
+            std::ranges::transform( components, pools.begin( ), [this]( auto const hash ) { return find_pool( hash ); } );
+            std::ranges::transform( excluded, excluded_pools.begin( ), [this]( auto const hash ) { return find_pool( hash ); } );
+            return ecs::runtime_view{ std::move( pools ), std::move( excluded_pools ) };
+        }
+
+
+        /**
+         * @brief The registry-wide change tick.
+         *
+         * Change-tracked components are stamped with it when added, replaced or accessed mutably through a view.
+         * The system_scheduler advances it around every system it runs and hands each system the tick of its
+         * previous run, so the added<T> and changed<T> filters of a system see exactly the changes made since.
+         *
+         * @complexity O(1)
+         * @return The current tick.
+         */
+        [[nodiscard]] auto tick( ) const noexcept -> tick_type
+        {
+            return tick_.load( std::memory_order_relaxed );
+        }
+
+
+        /**
+         * @brief Advances the change tick, later stamps compare as newer than every earlier one.
+         *
+         * @complexity O(1)
+         * @return The new tick.
+         * @note Thread safe, systems running concurrently only write components the others do not read.
+         */
+        auto advance_tick( ) noexcept -> tick_type
+        {
+            return tick_.fetch_add( 1U, std::memory_order_relaxed ) + 1U;
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @return The resource the registry storage is allocated from.
+         */
+        [[nodiscard]] auto resource( ) const noexcept -> std::pmr::memory_resource*
+        {
+            return resource_ptr_;
+        }
+
+
+        /**
+         * @brief What the pool of TComponent allocated so far: its arrays, not the pool object itself.
+         *
+         * @complexity O(1)
+         * @tparam TComponent The component type.
+         * @return The pool's allocation counters, all zero if the registry never saw the component.
+         */
+        template <detail::viewable_ecs_component TComponent>
+        [[nodiscard]] auto allocation_stats( ) const noexcept -> memory::allocation_stats
+        {
+            std::size_t const index = component_index<TComponent>( );
+            return index < pools_.size( ) && pools_[index].has_value( ) ? pools_[index]->allocation_stats( )
+                                                                        : memory::allocation_stats{};
+        }
+
+
+        /**
+         * @brief What every pool allocated so far, summed. Useful to size an arena: the peak over a level is an
+         * upper bound of what the pools need (peaks of different pools need not coincide).
+         *
+         * @complexity O(p) where p is the number of component types the registry saw.
+         * @return The sum of every pool's allocation counters.
+         */
+        [[nodiscard]] auto allocation_stats( ) const noexcept -> memory::allocation_stats
         {
-            return ecs::view<TComponents...>{ ensure_pool<TComponents>( )... };
+            memory::allocation_stats total{};
+            for ( auto const& pool : pools_ )
+            {
+                if ( pool.has_value( ) ) { total += pool->allocation_stats( ); }
+            }
+            return total;
+        }
+
+
+        /**
+         * @brief Gives back the memory the pools hold past their size, e.g. between levels.
+         *
+         * Pools keep their peak capacity otherwise: after a boss fight spawned thousands of projectiles, the
+         * projectile pool stays sized for them. Every pool is shrunk to its size (see sparse_set::shrink_to_fit),
+         * releasing the sparse pages no entity maps through anymore, and the scratch arrays of batched destructions
+         * are released.
+         *
+         * @complexity O(n + p) where n is the number of components and p the number of sparse pages, every array is
+         * reallocated to its size.
+         * @note Invalidates views, spans and component references, except to pointer-stable components. Call it
+         * between frames, not while iterating. The memory goes back to the registry's resource: an arena only
+         * reuses it once reset.
+         */
+        auto compact( ) -> void
+        {
+            for ( auto& pool : pools_ )
+            {
+                if ( pool.has_value( ) ) { pool->shrink_to_fit( ); }
+            }
+
+            batch_removals_.clear( );
+            batch_removals_.shrink_to_fit( );
+            batch_offsets_.clear( );
+            batch_offsets_.shrink_to_fit( );
+            batch_buckets_.clear( );
+            batch_buckets_.shrink_to_fit( );
+        }
+
+
+        /**
+         * Memory held by the pool of one component type, see memory_report.
+         */
+        struct pool_memory final
+        {
+            meta::hash::hash_type type{ 0U }; // meta::hash::type_hash_v of the component type
+            std::string_view name{};          // meta::type_name of the component type
+            std::size_t size{ 0U };           // components in the pool, tombstones of pointer-stable pools included
+            std::size_t capacity{ 0U };       // components the pool holds without growing
+            std::size_t bytes{ 0U };          // bytes held by the arrays and sparse pages of the pool
+        };
+
+
+        /**
+         * @brief Lists the memory held by the pool of every component type the registry saw, largest first.
+         *
+         * @code
+         * for (auto const& pool : registry.memory_report()) {
+         *     log("{}: {} / {} components, {} bytes", pool.name, pool.size, pool.capacity, pool.bytes);
+         * }
+         * @endcode
+         *
+         * @complexity O(p log p) where p is the number of component types the registry saw.
+         * @return One entry per pool, sorted by bytes held, descending.
+         */
+        [[nodiscard]] auto memory_report( ) const -> std::vector<pool_memory>
+        {
+            std::vector<pool_memory> report{};
+            report.reserve( pool_keys_.size( ) );
+            for ( pool_key const& key : pool_keys_ )
+            {
+                detail::base_reg_pool_type const& pool = *pools_[key.id];
+                report.push_back( { key.hash, key.name, pool.size( ), pool.capacity( ), pool.memory_usage( ) } );
+            }
+            std::ranges::stable_sort( report, std::ranges::greater{ }, &pool_memory::bytes );
+            return report;
+        }
+
+
+        /**
+         * @brief Gets the owning group of TOwned, creating it on first use.
+         *
+         * Owned pools keep the entities that have every TOwned packed at their front, in the same order, and the
+         * registry keeps them that way on emplace, remove and destruction. Iterating the group is a linear walk
+         * over parallel arrays, with no membership test. Creating the group sorts the existing entities in.
+         *
+         * @complexity O(1) once created, O(n) on creation where n is the size of the smallest owned pool.
+         * @tparam TOwned The component types to own, in any order.
+         * @return A handle to the group.
+         *
+         * @note A component can be owned by a single group, asking for a group that overlaps another one throws.
+         * Pointer-stable components cannot be owned, the group would have to move them.
+         */
+        template <detail::ecs_component... TOwned> requires ( sizeof...( TOwned ) > 1U && ( not pointer_stable<TOwned> && ... ) )
+        [[nodiscard]] auto group( ) -> ecs::group<TOwned...>
+        {
+            std::array<meta::sequential_index_type, sizeof...( TOwned )> const ids{ component_index<TOwned>( )... };
+            std::array<detail::base_reg_pool_type*, sizeof...( TOwned )> const pools{ &ensure_pool<TOwned>( )... };
+
+            detail::group_handler* handler = hooks_[ids.front( )].owner;
+            if ( handler == nullptr &&
+                 std::ranges::all_of( ids, [this]( auto const id ) { return hooks_[id].owner == nullptr; } ) )
+            {
+                handler = &groups_.emplace_back( ref::make_unique<detail::group_handler>(
+                    std::vector<detail::base_reg_pool_type*>{ pools.begin( ), pools.end( ) },
+                    std::vector<meta::sequential_index_type>{ ids.begin( ), ids.end( ) } ) ).value( );
+
+                for ( auto const id : ids ) { hooks_[id].owner = handler; }
+            }
+            if ( handler == nullptr || not handler->owns( ids ) )
+            {
+                startle( "registry::group: a component is already owned by another group!" );
+            }
+            return ecs::group<TOwned...>{ *handler, ensure_pool<TOwned>( )... };
         }
 
     private:
-        std::unordered_map<meta::hash::hash_type, unique_ref<detail::base_reg_pool_type>> pools_{};
-        entity_allocator entity_alloc_{};
+        std::pmr::memory_resource* const resource_ptr_;
+
+        // indexed by detail::component_sequence, empty where the registry never saw the component
+        std::pmr::vector<detail::unique_pool_type> pools_;
+
+        // indexed like pools_, the group owning each pool and its signals, if any. Groups and signals are created
+        // once per component type at most and stay on the default resource
+        std::pmr::vector<detail::pool_hooks> hooks_;
+        std::vector<unique_ref<detail::group_handler>> groups_{};
+
+        // type hash, component id and type name of every pool, sorted by hash, for the lookups of runtime views and
+        // the memory report
+        struct pool_key final
+        {
+            meta::hash::hash_type hash{ 0U };
+            meta::sequential_index_type id{ 0U };
+            std::string_view name{};
+        };
+        std::pmr::vector<pool_key> pool_keys_;
+        std::vector<unique_ref<component_signals>> signals_{};
+
+        // which pools each entity index is in, kept in sync by emplace, remove and destruction
+        detail::signature_table signatures_;
+
+        // stamps of change-tracked pools, 0 is older than anything the registry stamps
+        std::atomic<tick_type> tick_{ 1U };
+
+        // scratch space of batched destructions, kept to reuse the memory
+        std::pmr::vector<std::pair<meta::sequential_index_type, entity_type>> batch_removals_;
+        std::pmr::vector<std::size_t> batch_offsets_;
+        std::pmr::vector<entity_type> batch_buckets_;
+
+        entity_allocator entity_alloc_;
+
+
+        template <detail::viewable_ecs_component TComponent>
+        [[nodiscard]] static auto component_index( ) noexcept -> meta::sequential_index_type
+        {
+            return detail::component_sequence::index_of<TComponent>( );
+        }
 
 
         /**
@@ -178,43 +704,254 @@ namespace rst::ecs
          *
          * @note Const correctness is enforced at template constraint level, as the methods can only be called using the correct
          *
+         * @complexity O(1), one indexed load once the pool exists
          * @tparam TComponent
          * @return The component pool for TComponent.
          */
         template <detail::viewable_ecs_component TComponent>
         [[nodiscard]] auto ensure_pool( ) -> detail::reg_pool_type<TComponent>&
         {
-            meta::hash::hash_type const type_hash = meta::hash::type_hash_v<TComponent>;
-            auto [it, inserted] = pools_.try_emplace( type_hash, ref::make_unique<detail::reg_pool_type<TComponent>>( ) );
-            return static_cast<detail::reg_pool_type<TComponent>&>( it->second.value( ) );
+            std::size_t const index = component_index<TComponent>( );
+            if ( index >= pools_.size( ) )
+            {
+                pools_.resize( index + 1U );
+                hooks_.resize( index + 1U );
+                signatures_.reserve_components( index + 1U );
+            }
+            if ( not pools_[index].has_value( ) )
+            {
+                pools_[index] = detail::make_pool<TComponent>( resource_ptr_ );
+                index_pool( {
+                    meta::hash::type_hash_v<TComponent>, static_cast<meta::sequential_index_type>( index ),
+                    meta::type_name<TComponent>( ) } );
+                if constexpr ( change_tracked<TComponent> )
+                {
+                    static_cast<detail::reg_pool_type<TComponent>&>( *pools_[index] ).bind_clock( tick_ );
+                }
+            }
+            return static_cast<detail::reg_pool_type<TComponent>&>( *pools_[index] );
         }
 
 
-        template <detail::viewable_ecs_component TComponent>
-        [[nodiscard]] auto has_impl( entity_type const entity ) const -> bool
+        auto index_pool( pool_key const& key ) -> void
+        {
+            auto const it = std::ranges::lower_bound( pool_keys_, key.hash, { }, &pool_key::hash );
+            ensure( it == pool_keys_.end( ) || it->hash != key.hash, "two component types share a type hash!" );
+            pool_keys_.insert( it, key );
+        }
+
+
+        /**
+         * @complexity O(log p) where p is the number of component types the registry saw
+         * @return The pool of the component type hashed to @hash, null if the registry never saw it
+         */
+        [[nodiscard]] auto find_pool( meta::hash::hash_type const hash ) noexcept -> detail::base_reg_pool_type*
+        {
+            auto const it = std::ranges::lower_bound( pool_keys_, hash, { }, &pool_key::hash );
+            return it != pool_keys_.end( ) && it->hash == hash ? &*pools_[it->id] : nullptr;
+        }
+
+
+        template <typename TView, typename... TComponents, typename... TFilters, typename... TExcluded>
+        [[nodiscard]] auto make_view_impl(
+            meta::type_list<TComponents...>, meta::type_list<TFilters...>, meta::type_list<TExcluded...>,
+            tick_type const since ) -> TView
+        {
+            return TView{
+                ensure_pool<typename detail::view_component_traits<TComponents>::component_type>( )...,
+                ensure_pool<typename detail::tick_filter_traits<TFilters>::component_type>( )...,
+                ensure_pool<TExcluded>( )...,
+                since
+            };
+        }
+
+
+        template <typename TView>
+        [[nodiscard]] auto make_view( tick_type const since ) -> TView
+        {
+            return make_view_impl<TView>(
+                typename TView::component_list{ }, typename TView::filter_list{ }, typename TView::exclude_list{ }, since );
+        }
+
+
+        template <detail::ecs_component TComponent>
+        [[nodiscard]] auto ensure_signals( ) -> component_signals&
+        {
+            static_cast<void>( ensure_pool<TComponent>( ) );
+            detail::pool_hooks& hooks = hooks_[component_index<TComponent>( )];
+            if ( hooks.signals == nullptr )
+            {
+                hooks.signals = &signals_.emplace_back( ref::make_unique<component_signals>( ) ).value( );
+            }
+            return *hooks.signals;
+        }
+
+
+        // the group and signals of a pool, after one of its components was emplaced
+        template <detail::ecs_component TComponent>
+        auto run_emplace_hooks(
+            detail::reg_pool_type<TComponent>& pool, detail::pool_hooks const hooks, entity_type const entity,
+            bool const replaced ) -> TComponent&
+        {
+            if ( hooks.owner != nullptr ) { hooks.owner->on_emplace( entity ); }
+            if ( hooks.signals != nullptr ) { hooks.signals->broadcast_emplace( *this, entity, replaced ); }
+
+            // joining a group or the listeners may have moved the component, the reference has to be fetched again
+            return pool.unsafe_get( entity );
+        }
+
+
+        template <detail::ecs_component TComponent, typename TValueAt>
+        auto emplace_batch( std::span<entity_type const> const entities, TValueAt&& value_at ) -> void
+        {
+            auto& pool = ensure_pool<TComponent>( );
+            pool.reserve( pool.size( ) + entities.size( ) );
+
+            meta::sequential_index_type const id = component_index<TComponent>( );
+            detail::pool_hooks const hooks       = hooks_[id];
+            for ( std::size_t i = 0U; i < entities.size( ); ++i )
+            {
+                entity_type const entity = entities[i];
+                ensure( alive( entity ), "emplace_n on a dead or stale entity!" );
+
+                pool.insert_or_replace( entity, value_at( i ) );
+                bool const replaced = signatures_.set( entity_traits::to_index( entity ), id );
+                if ( not hooks.empty( ) ) { run_emplace_hooks<TComponent>( pool, hooks, entity, replaced ); }
+            }
+        }
+
+
+        // gives every entity of @entities a copy of @value, in a single append while none of them has a TComponent
+        template <detail::ecs_component TComponent>
+        auto append_fresh( std::span<entity_type const> const entities, TComponent const& value ) -> void
         {
-            meta::hash::hash_type const type_hash = meta::hash::type_hash_v<TComponent, true>;
+            auto& pool = ensure_pool<TComponent>( );
+            meta::sequential_index_type const id = component_index<TComponent>( );
 
-            auto const it = pools_.find( type_hash );
-            return it != pools_.end( ) && it->second->has( entity );
+            // listeners of the batch creation or of the pools filled before this one may have emplaced a TComponent
+            // already, or destroyed some of the entities: appending then would duplicate packed entries
+            bool const fresh = std::ranges::none_of(
+                entities, [this, id]( entity_type const entity )
+                {
+                    return not alive( entity ) || signatures_.test( entity_traits::to_index( entity ), id );
+                } );
+            if ( not fresh )
+            {
+                for ( entity_type const entity : entities )
+                {
+                    if ( alive( entity ) ) { emplace<TComponent>( entity, value ); }
+                }
+                return;
+            }
+
+            pool.append( entities, value );
+            for ( entity_type const entity : entities ) { signatures_.set( entity_traits::to_index( entity ), id ); }
+
+            if ( detail::pool_hooks const hooks = hooks_[id]; not hooks.empty( ) )
+            {
+                for ( entity_type const entity : entities ) { run_emplace_hooks<TComponent>( pool, hooks, entity, false ); }
+            }
+        }
+
+
+        // on_destroy of every component of @entity, before any of them is removed
+        auto signal_destruction( entity_type const entity ) -> void
+        {
+            signatures_.for_each(
+                entity_traits::to_index( entity ), [this, entity]( meta::sequential_index_type const id )
+                {
+                    if ( component_signals* const signals = hooks_[id].signals; signals != nullptr )
+                    {
+                        signals->on_destroy.broadcast( *this, entity );
+                    }
+                } );
         }
 
 
         auto destroy_entity( entity_type const entity ) -> void
         {
-            for ( auto& pool : pools_ | std::views::values )
+            if ( not signals_.empty( ) ) { signal_destruction( entity ); }
+
+            // only the pools in the entity's signature. Leaving a group before each removal keeps the removals
+            // popping non-grouped elements, the group ignores the entity once it left
+            signatures_.consume(
+                entity_traits::to_index( entity ), [this, entity]( meta::sequential_index_type const id )
+                {
+                    if ( detail::group_handler* const owner = hooks_[id].owner; owner != nullptr )
+                    {
+                        owner->on_remove( entity );
+                    }
+                    pools_[id]->remove( entity );
+                } );
+        }
+
+
+        auto destroy_entities( std::span<entity_type const> const entities ) -> void
+        {
+            if ( not signals_.empty( ) )
+            {
+                for ( entity_type const entity : entities ) { signal_destruction( entity ); }
+            }
+
+            // 1. collect the removals and count them per pool
+            batch_removals_.clear( );
+            batch_offsets_.assign( pools_.size( ) + 1U, 0U );
+            for ( entity_type const entity : entities )
+            {
+                signatures_.consume(
+                    entity_traits::to_index( entity ), [this, entity]( meta::sequential_index_type const id )
+                    {
+                        batch_removals_.emplace_back( id, entity );
+                        ++batch_offsets_[id + 1U];
+                    } );
+            }
+
+            // 2. bucket them per pool (counting sort), entities keep their order inside a bucket
+            std::partial_sum( batch_offsets_.begin( ), batch_offsets_.end( ), batch_offsets_.begin( ) );
+            batch_buckets_.resize( batch_removals_.size( ) );
+            for ( auto const& [id, entity] : batch_removals_ )
             {
-                pool->remove( entity );
+                batch_buckets_[batch_offsets_[id]++] = entity;
+            }
+
+            // 3. one batch per pool, each entity leaving the pool's group first. Bucket id ends at offsets[id] now
+            std::size_t begin{ 0U };
+            for ( std::size_t id = 0U; id < pools_.size( ); ++id )
+            {
+                std::span<entity_type const> const bucket{ batch_buckets_.data( ) + begin, batch_offsets_[id] - begin };
+                begin = batch_offsets_[id];
+                if ( bucket.empty( ) ) { continue; }
+
+                if ( detail::group_handler* const owner = hooks_[id].owner; owner != nullptr )
+                {
+                    for ( entity_type const entity : bucket ) { owner->on_remove( entity ); }
+                }
+                pools_[id]->remove( bucket );
             }
         }
 
 
         auto clear_entities( ) -> void
         {
-            for ( auto& pool : pools_ | std::views::values )
+            for ( std::size_t id = 0U; id < hooks_.size( ) && not signals_.empty( ); ++id )
+            {
+                if ( component_signals* const signals = hooks_[id].signals; signals != nullptr )
+                {
+                    for ( entity_type const entity : pools_[id]->packed( ) )
+                    {
+                        if ( entity != detail::base_reg_pool_type::tombstone ) { signals->on_destroy.broadcast( *this, entity ); }
+                    }
+                }
+            }
+            for ( auto& group : groups_ )
+            {
+                group->on_clear( );
+            }
+            for ( auto& pool : pools_ )
             {
-                pool->clear( );
+                if ( pool.has_value( ) ) { pool->clear( ); }
             }
+            signatures_.clear( );
         }
     };
 }
@@ -4,15 +4,87 @@
 #include <rst/pch.h>
 
 #include <rst/data_type/sparse_set.h>
+#include <rst/data_type/unique_ref.h>
+#include <rst/meta/type_index.h>
+#include <rst/__core/__ecs/component_traits.h>
 #include <rst/__core/__ecs/entity.h>
 
 
+namespace rst::ecs
+{
+    struct component_signals;
+}
+
+
 namespace rst::ecs::detail
 {
+    class group_handler;
+
     using base_reg_pool_type = base_sparse_set<entity_type>;
 
+    /**
+     * Pools always store the mutable component type, so that T and T const share a pool. Const access is enforced
+     * by the view and registry signatures. Change ticks and pointer stability only apply to the component types that
+     * opted in, and tags (empty component types) store the entities alone.
+     */
     template <typename TComponent>
-    using reg_pool_type = sparse_set<TComponent, entity_type>;
+    using reg_pool_type = sparse_set<
+        std::remove_const_t<TComponent>, entity_type, entity_traits,
+        component_traits<std::remove_const_t<TComponent>>::track_changes,
+        component_traits<std::remove_const_t<TComponent>>::pointer_stable>;
+
+    static_assert( std::is_same_v<reg_pool_type<entity_type>::tick_type, tick_type> );
+
+    /**
+     * Destroys a pool and gives its memory back to the resource it was allocated from, see make_pool.
+     */
+    struct pool_deleter final
+    {
+        std::pmr::memory_resource* resource{ nullptr };
+        void ( *destroy )( base_reg_pool_type*, std::pmr::memory_resource* ) noexcept { nullptr };
+
+        auto operator()( base_reg_pool_type* const pool ) const noexcept -> void { destroy( pool, resource ); }
+    };
+
+    using unique_pool_type = unique_ref<base_reg_pool_type, pool_deleter>;
+
+
+    /**
+     * Allocates the pool of TComponent from @resource, and every array of the pool along with it.
+     */
+    template <typename TComponent>
+    [[nodiscard]] auto make_pool( std::pmr::memory_resource* const resource ) -> unique_pool_type
+    {
+        using pool_type = reg_pool_type<TComponent>;
+
+        std::pmr::polymorphic_allocator<> allocator{ resource };
+        return unique_pool_type{
+            allocator.new_object<pool_type>( resource ),
+            pool_deleter{
+                resource,
+                []( base_reg_pool_type* const pool, std::pmr::memory_resource* const from ) noexcept
+                {
+                    std::pmr::polymorphic_allocator<>{ from }.delete_object( static_cast<pool_type*>( pool ) );
+                } } };
+    }
+
+
+    /**
+     * Dense component ids used to address the registry's pool array.
+     */
+    using component_sequence = meta::type_sequence<base_reg_pool_type>;
+
+    /**
+     * What the registry has to run besides the pool itself when a component is added or removed. Both are null for
+     * most pools, so the hot paths get away with a single branch.
+     */
+    struct pool_hooks final
+    {
+        group_handler* owner{ nullptr };        // the group owning the pool
+        component_signals* signals{ nullptr }; // lifecycle listeners, once someone asked for them
+
+        [[nodiscard]] auto empty( ) const noexcept -> bool { return owner == nullptr && signals == nullptr; }
+    };
 }
 
 
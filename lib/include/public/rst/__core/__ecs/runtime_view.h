@@ -0,0 +1,169 @@
+#ifndef RST_ECS_RUNTIME_VIEW_H
+#define RST_ECS_RUNTIME_VIEW_H
+
+#include <rst/pch.h>
+
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief A view whose component types are chosen at runtime, for tools and scripting.
+     *
+     * Built by registry::runtime_view from a list of meta::hash::type_hash_v values. Like view, it walks the
+     * smallest of the requested pools and checks the others, and each( ) hands out runs where the packed order of
+     * every pool lines up with the pivot with no lookup past the first entity of the run. Components come out as
+     * raw pointers, in the order their hashes were given.
+     *
+     * @code
+     * std::array const components{ meta::hash::type_hash_v<transform>, meta::hash::type_hash_v<sprite> };
+     * auto view = registry.runtime_view( components );
+     *
+     * view.each([&](entity_type entity, std::span<void* const> components) {
+     *     inspector.show(entity, components[0], components[1]);
+     * });
+     * @endcode
+     *
+     * @note The view sees no component type, writes through its pointers are not stamped as changes for
+     * changed<T> filters. Tags (empty component types) all point to one shared instance.
+     * @note Same invalidation rules as view: record structural changes in a command_buffer and play them back after
+     * the loop.
+     */
+    class runtime_view final
+    {
+    public:
+        class iterator;
+
+
+        /**
+         * @brief Constructs a view over the entities in every pool of @pools and in none of @excluded_pools. Use
+         * registry::runtime_view to get one.
+         *
+         * @param pools The pools to intersect, in the order the components are handed out. A null pool, e.g. for a
+         * component the registry never saw, empties the view.
+         * @param excluded_pools The pools whose entities are skipped, null ones are ignored.
+         *
+         * @complexity O(k) where k is the number of pools.
+         */
+        runtime_view(
+            std::vector<detail::base_reg_pool_type*> pools, std::vector<detail::base_reg_pool_type*> excluded_pools );
+
+
+        /**
+         * @complexity O(k) where k is the number of pools.
+         * @return True if @entity is in every required pool and in none of the excluded ones.
+         */
+        [[nodiscard]] auto contains( entity_type entity ) const noexcept -> bool;
+
+        /**
+         * @complexity O(1)
+         * @param entity The entity whose component to look up.
+         * @param slot Position of the component in the list the view was built from.
+         * @return The component of @entity, null if @entity lacks it.
+         */
+        [[nodiscard]] auto get( entity_type entity, std::size_t slot ) const noexcept -> void*;
+
+        /**
+         * @return Number of components handed out per entity.
+         */
+        [[nodiscard]] auto component_count( ) const noexcept -> std::size_t;
+
+        /**
+         * @return Upper bound of the number of entities in the view, the size of the pivot.
+         */
+        [[nodiscard]] auto size_hint( ) const noexcept -> std::size_t;
+
+
+        /**
+         * @brief Applies a function to each entity of the view with its components.
+         *
+         * @tparam TDelegate Function type that accepts (entity_type, std::span<void* const>), one pointer per
+         * component, in the order the view was built from.
+         * @param delegate Function to apply to each entity and its components.
+         *
+         * @complexity O(n×k) where n is the size of the pivot, k is the number of pools. Runs that line up in every
+         * pool cost a compare per pool and entity, no sparse lookup.
+         */
+        template <std::invocable<entity_type, std::span<void* const>> TDelegate>
+        auto each( TDelegate&& delegate ) const -> void
+        {
+            if ( pivot_ptr_ == nullptr )
+            {
+                return;
+            }
+
+            std::span<entity_type const> const pivot = pivot_ptr_->packed( );
+            std::vector<detail::base_reg_pool_type::erased_run> runs( pools_.size( ) );
+            std::vector<std::span<entity_type const>> packed( pools_.size( ) );
+            std::vector<void*> components( pools_.size( ) );
+
+            std::size_t pos{ 0U };
+            while ( pos < pivot.size( ) )
+            {
+                std::size_t const length = next_run( pos, runs, packed );
+                for ( std::size_t offset = 0U; offset < length; ++offset )
+                {
+                    for ( std::size_t slot = 0U; slot < runs.size( ); ++slot )
+                    {
+                        components[slot] = runs[slot].data + offset * runs[slot].stride;
+                    }
+                    delegate( pivot[pos + offset], std::span<void* const>{ components } );
+                }
+                pos += std::max( length, std::size_t{ 1U } );
+            }
+        }
+
+
+        [[nodiscard]] auto begin( ) const noexcept -> iterator;
+        [[nodiscard]] auto end( ) const noexcept -> iterator;
+
+
+        /**
+         * @brief Iterator over the entities of a runtime view, see get( ) for their components.
+         */
+        class iterator final
+        {
+        public:
+            iterator( runtime_view const& view, std::size_t pos ) noexcept;
+
+            [[nodiscard]] auto operator*( ) const noexcept -> entity_type;
+            auto operator++( ) noexcept -> iterator&;
+            auto operator++( int ) noexcept -> iterator;
+
+            [[nodiscard]] auto operator==( iterator const& other ) const noexcept -> bool { return pos_ == other.pos_; }
+            [[nodiscard]] auto operator!=( iterator const& other ) const noexcept -> bool { return pos_ != other.pos_; }
+
+        private:
+            runtime_view const* view_ptr_;
+            std::size_t pos_;
+        };
+
+    private:
+        std::vector<detail::base_reg_pool_type*> const pools_;
+        std::vector<detail::base_reg_pool_type*> const excluded_pools_;
+        detail::base_reg_pool_type* pivot_ptr_{ nullptr };
+
+
+        [[nodiscard]] auto excludes( entity_type entity ) const noexcept -> bool;
+
+        /**
+         * @return The first pivot position from @pos holding an entity of the view, or the pivot's size
+         */
+        [[nodiscard]] auto next_match( std::size_t pos ) const noexcept -> std::size_t;
+
+        /**
+         * @brief Locates the run of entities of the view starting at pivot position @pos.
+         * @param runs Filled with the elements of every pool from the first entity of the run on.
+         * @param packed Filled with the packed array of every pool from the first entity of the run on.
+         * @return Length of the run, 0 if the entity at @pos is not in the view
+         */
+        [[nodiscard]] auto next_run(
+            std::size_t pos, std::span<detail::base_reg_pool_type::erased_run> runs,
+            std::span<std::span<entity_type const>> packed ) const noexcept -> std::size_t;
+    };
+}
+
+
+#endif //!RST_ECS_RUNTIME_VIEW_H
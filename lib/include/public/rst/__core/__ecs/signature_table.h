@@ -0,0 +1,152 @@
+#ifndef RST_ECS_SIGNATURE_TABLE_H
+#define RST_ECS_SIGNATURE_TABLE_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_index.h>
+#include <rst/__core/__ecs/entity.h>
+
+
+namespace rst::ecs::detail
+{
+    /**
+     * @brief Per-entity bitset of the components an entity owns, indexed by entity index and component id.
+     *
+     * Rows are stored back to back in a single array, each one as wide as needed for the largest component id
+     * seen so far, rounded up to whole words. With fewer than 64 component types a row is one word, so a
+     * membership test is a single load and mask, and destroying an entity visits only the pools whose bit is set.
+     *
+     * @note Rows are keyed by entity index only, the registry checks handle versions before trusting a row.
+     */
+    class signature_table final
+    {
+    public:
+        using word_type = uint64_t;
+
+        static constexpr std::size_t bits_per_word{ std::numeric_limits<word_type>::digits };
+
+        signature_table( ) noexcept  = default;
+        explicit signature_table( std::pmr::memory_resource* const resource ) noexcept : words_{ resource } { }
+        ~signature_table( ) noexcept = default;
+
+        signature_table( signature_table const& )                        = delete;
+        signature_table( signature_table&& ) noexcept                    = delete;
+        auto operator=( signature_table const& ) -> signature_table&     = delete;
+        auto operator=( signature_table&& ) noexcept -> signature_table& = delete;
+
+        /**
+         * @brief Widens the rows so that ids below @component_count can be stored, keeping every bit set.
+         * @complexity O(n) where n is the number of rows, only when the row grows by a word
+         */
+        auto reserve_components( std::size_t component_count ) -> void;
+
+        /**
+         * @brief Marks @component_id as owned by the entity at @index.
+         * @complexity O(1) amortized, the table grows to fit @index
+         * @return True if it was already marked
+         */
+        auto set( entity_traits::index_type const index, meta::sequential_index_type const component_id ) -> bool
+        {
+            std::size_t const word = row_offset( index ) + component_id / bits_per_word;
+            if ( word >= words_.size( ) )
+            {
+                words_.resize( row_offset( index + 1U ), 0U );
+            }
+            word_type const previous = std::exchange( words_[word], words_[word] | mask_of( component_id ) );
+            return ( previous & mask_of( component_id ) ) != 0U;
+        }
+
+
+        /**
+         * @brief Marks @component_id as not owned by the entity at @index.
+         * @complexity O(1)
+         */
+        auto reset( entity_traits::index_type const index, meta::sequential_index_type const component_id ) noexcept -> void
+        {
+            if ( std::size_t const word = row_offset( index ) + component_id / bits_per_word; word < words_.size( ) )
+            {
+                words_[word] &= ~mask_of( component_id );
+            }
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @return True if the entity at @index owns @component_id. Ids beyond the reserved ones are never owned.
+         */
+        [[nodiscard]] auto test(
+            entity_traits::index_type const index, meta::sequential_index_type const component_id ) const noexcept -> bool
+        {
+            std::size_t const word = row_offset( index ) + component_id / bits_per_word;
+            return component_id < row_width_ * bits_per_word && word < words_.size( ) &&
+                   ( words_[word] & mask_of( component_id ) ) != 0U;
+        }
+
+
+        /**
+         * @brief Calls @delegate with every component id owned by the entity at @index, ascending.
+         * @complexity O(w + k) where w is the row width in words and k the number of owned components
+         */
+        template <std::invocable<meta::sequential_index_type> TDelegate>
+        auto for_each( entity_traits::index_type const index, TDelegate&& delegate ) const -> void
+        {
+            std::size_t const offset = row_offset( index );
+            if ( offset >= words_.size( ) ) { return; }
+
+            for ( std::size_t word = 0U; word < row_width_; ++word )
+            {
+                for ( word_type bits = words_[offset + word]; bits != 0U; bits &= bits - 1U )
+                {
+                    delegate( static_cast<meta::sequential_index_type>( word * bits_per_word + std::countr_zero( bits ) ) );
+                }
+            }
+        }
+
+
+        /**
+         * @brief Calls @delegate with every component id owned by the entity at @index, ascending, then empties the
+         * row. The delegate must not modify the table.
+         * @complexity O(w + k) where w is the row width in words and k the number of owned components
+         */
+        template <std::invocable<meta::sequential_index_type> TDelegate>
+        auto consume( entity_traits::index_type const index, TDelegate&& delegate ) -> void
+        {
+            std::size_t const offset = row_offset( index );
+            if ( offset >= words_.size( ) ) { return; }
+
+            for ( std::size_t word = 0U; word < row_width_; ++word )
+            {
+                for ( word_type bits = std::exchange( words_[offset + word], 0U ); bits != 0U; bits &= bits - 1U )
+                {
+                    delegate( static_cast<meta::sequential_index_type>( word * bits_per_word + std::countr_zero( bits ) ) );
+                }
+            }
+        }
+
+
+        /**
+         * @brief Empties every row, keeping the memory.
+         * @complexity O(n) where n is the number of rows
+         */
+        auto clear( ) noexcept -> void;
+
+    private:
+        std::pmr::vector<word_type> words_{};
+        std::size_t row_width_{ 1U }; // words per row
+
+
+        [[nodiscard]] auto row_offset( entity_traits::index_type const index ) const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>( index ) * row_width_;
+        }
+
+
+        [[nodiscard]] static constexpr auto mask_of( meta::sequential_index_type const component_id ) noexcept -> word_type
+        {
+            return word_type{ 1U } << ( component_id % bits_per_word );
+        }
+    };
+}
+
+
+#endif //!RST_ECS_SIGNATURE_TABLE_H
@@ -0,0 +1,554 @@
+#ifndef RST_ECS_SNAPSHOT_H
+#define RST_ECS_SNAPSHOT_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/hash.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/ecs_error.h>
+#include <rst/__core/__ecs/entity.h>
+#include <rst/__core/__ecs/registry.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief Anything snapshot::save can stream bytes to.
+     */
+    template <typename T>
+    concept snapshot_output = requires( T& output, std::span<std::byte const> bytes )
+    {
+        output.write( bytes );
+    };
+
+
+    /**
+     * @brief Anything snapshot::load can stream bytes from. read and skip return false once the input runs out.
+     * Inputs that hold the whole snapshot in memory may also provide take( n ), returning a view of the next n
+     * bytes (empty if there are fewer), so that pools are copied straight from the buffer. Inputs that know their
+     * size may provide remaining( ), the number of bytes left, so that counts read from a corrupt snapshot are
+     * rejected before anything is sized after them.
+     */
+    template <typename T>
+    concept snapshot_input = requires( T& input, std::span<std::byte> bytes, std::size_t count )
+    {
+        { input.read( bytes ) } -> std::same_as<bool>;
+        { input.skip( count ) } -> std::same_as<bool>;
+    };
+
+
+    // +--------------------------------+
+    // | MEMORY STREAMS                 |
+    // +--------------------------------+
+    /**
+     * @brief Appends a snapshot to a byte buffer, e.g. one per frame of a rollback window.
+     */
+    class memory_snapshot_output final
+    {
+    public:
+        explicit memory_snapshot_output( std::vector<std::byte>& buffer ) noexcept;
+
+        auto write( std::span<std::byte const> bytes ) -> void;
+
+    private:
+        std::vector<std::byte>& buffer_ref_;
+    };
+
+
+    /**
+     * @brief Reads a snapshot from a byte buffer, which must outlive the input.
+     */
+    class memory_snapshot_input final
+    {
+    public:
+        explicit memory_snapshot_input( std::span<std::byte const> buffer ) noexcept;
+
+        [[nodiscard]] auto read( std::span<std::byte> bytes ) noexcept -> bool;
+        [[nodiscard]] auto skip( std::size_t count ) noexcept -> bool;
+        [[nodiscard]] auto take( std::size_t count ) noexcept -> std::span<std::byte const>;
+        [[nodiscard]] auto remaining( ) const noexcept -> std::size_t;
+
+    private:
+        std::span<std::byte const> buffer_;
+        std::size_t cursor_{ 0U };
+    };
+
+
+    // +--------------------------------+
+    // | FILE STREAMS                   |
+    // +--------------------------------+
+    /**
+     * @brief Writes a snapshot to a file, created or overwritten.
+     */
+    class file_snapshot_output final
+    {
+    public:
+        explicit file_snapshot_output( std::filesystem::path const& path );
+
+        /**
+         * @return False if the file could not be opened or a write failed.
+         */
+        [[nodiscard]] auto good( ) const noexcept -> bool;
+
+        auto write( std::span<std::byte const> bytes ) -> void;
+
+    private:
+        std::ofstream stream_;
+    };
+
+
+    /**
+     * @brief Reads a snapshot from a file.
+     */
+    class file_snapshot_input final
+    {
+    public:
+        explicit file_snapshot_input( std::filesystem::path const& path );
+
+        /**
+         * @return False if the file could not be opened or a read ran past its end.
+         */
+        [[nodiscard]] auto good( ) const noexcept -> bool;
+
+        [[nodiscard]] auto read( std::span<std::byte> bytes ) -> bool;
+        [[nodiscard]] auto skip( std::size_t count ) -> bool;
+        [[nodiscard]] auto remaining( ) const noexcept -> std::size_t;
+
+    private:
+        std::ifstream stream_;
+        std::size_t remaining_{ 0U };
+    };
+
+
+    // +--------------------------------+
+    // | SNAPSHOT                       |
+    // +--------------------------------+
+    /**
+     * @brief Binary dump and restore of a registry: the entities and the pools of a chosen set of components.
+     *
+     * Components are trivially copyable, so a pool is saved as its arrays and restored with one bulk copy per
+     * array, never an emplace per entity. Pools are keyed by meta::hash::type_hash_v, so a snapshot loads into
+     * any registry regardless of the order component types were first used in, and pools the loader was not
+     * asked for are skipped.
+     *
+     * Layout, every array padded to 8 bytes:
+     * - header: magic, format_version, entity size, pool count, slot and free handle counts, change tick;
+     * - the entity allocator's slots and free handles, so that versions and the reuse order survive (replays
+     * create the same handles after a load as the original run did);
+     * - per pool: type hash, element size, whether ticks follow and the entity count, then the entities, the
+     * components (none for tags) and the added and changed ticks of change-tracked pools.
+     *
+     * @code
+     * std::vector<std::byte> quick_save{};
+     * memory_snapshot_output output{ quick_save };
+     * snapshot::save<transform, velocity, health>( registry, output );
+     *
+     * // ...
+     *
+     * memory_snapshot_input input{ quick_save };
+     * if ( not snapshot::load<transform, velocity, health>( registry, input ) )
+     * {
+     *     // rejected, the registry is left empty
+     * }
+     * @endcode
+     *
+     * @note Snapshots are raw memory: only load them in a build with the same component layouts, compiler and
+     * endianness as the one that saved them. Type hashes catch renamed components and sizes catch most layout
+     * changes, not all of them. Pointers stored in components are saved as they are.
+     */
+    class snapshot final
+    {
+    public:
+        static constexpr uint32_t format_version{ 1U };
+
+        snapshot( ) = delete;
+
+        /**
+         * @brief Writes the entities of @registry and its TComponents pools to @output.
+         *
+         * @complexity O(e + n) where e is the number of entity slots and n the number of saved components, a
+         * couple of bulk writes per pool. Pointer-stable pools are gathered first to leave their tombstones out
+         * @tparam TComponents The component types to save, pools the registry never created are saved empty.
+         */
+        template <detail::ecs_component... TComponents, snapshot_output TOutput>
+        static auto save( registry const& registry, TOutput& output ) -> void
+        {
+            entity_allocator const& entities = registry.entity_alloc_;
+
+            file_header const header{
+                magic, format_version, sizeof( entity_type ), sizeof...( TComponents ), entities.slots_.size( ),
+                entities.free_handles_.size( ), registry.tick( ), 0U
+            };
+            write_array( output, std::span{ &header, 1U } );
+            write_array( output, std::span<entity_type const>{ entities.slots_ } );
+            write_array( output, std::span<entity_type const>{ entities.free_handles_ } );
+
+            ( save_pool<TComponents>( registry, output ), ... );
+        }
+
+
+        /**
+         * @brief Replaces the content of @registry with the snapshot read from @input.
+         *
+         * The registry is cleared first (listeners get their on_destroy signals), then the entity allocator, the
+         * change tick and the TComponents pools are restored with bulk copies. Restored components do not
+         * broadcast on_construct, and owning groups are rebuilt once every pool is in.
+         *
+         * @complexity O(e + n) where e is the number of entity slots and n the number of loaded components
+         * @tparam TComponents The component types to load, the snapshot's other pools are skipped.
+         * @return Nothing, or why the snapshot was rejected. A rejected snapshot leaves the registry empty.
+         */
+        template <detail::ecs_component... TComponents, snapshot_input TInput>
+        static auto load( registry& registry, TInput& input ) -> std::expected<void, ecs_error>
+        {
+            auto result = load_impl<TComponents...>( registry, input );
+            if ( not result.has_value( ) )
+            {
+                registry.entity_alloc_.clear( );
+            }
+            return result;
+        }
+
+    private:
+        static constexpr uint32_t magic{ 0x53545352U }; // "RSTS" once written little-endian
+        static constexpr std::size_t alignment{ 8U };
+        static constexpr std::array<std::byte, alignment> padding{ };
+
+        struct file_header final
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entity_size;
+            uint32_t pool_count;
+            uint64_t slot_count;
+            uint64_t free_count;
+            tick_type tick;
+            uint32_t reserved;
+        };
+
+
+        struct pool_header final
+        {
+            meta::hash::hash_type type_hash;
+            uint32_t element_size; // 0 for tags
+            uint32_t has_ticks;
+            uint64_t count;
+        };
+
+
+        // scratch arrays of inputs that cannot hand out views of their bytes, reused across pools
+        struct load_buffers final
+        {
+            std::vector<std::byte> entities{};
+            std::vector<std::byte> elements{};
+            std::vector<std::byte> added{};
+            std::vector<std::byte> changed{};
+        };
+
+
+        [[nodiscard]] static constexpr auto padded( std::size_t const bytes ) noexcept -> std::size_t
+        {
+            return ( bytes + alignment - 1U ) & ~( alignment - 1U );
+        }
+
+
+        template <typename TComponent>
+        [[nodiscard]] static constexpr auto element_size( ) noexcept -> uint32_t
+        {
+            return detail::reg_pool_type<TComponent>::is_tag_set ? 0U : static_cast<uint32_t>( sizeof( TComponent ) );
+        }
+
+
+        template <typename T, snapshot_output TOutput>
+        static auto write_array( TOutput& output, std::span<T const> const values ) -> void
+        {
+            std::span<std::byte const> const bytes = std::as_bytes( values );
+            output.write( bytes );
+            output.write( std::span{ padding }.first( padded( bytes.size( ) ) - bytes.size( ) ) );
+        }
+
+
+        template <detail::ecs_component TComponent, snapshot_output TOutput>
+        static auto save_pool( registry const& registry, TOutput& output ) -> void
+        {
+            using pool_type = detail::reg_pool_type<TComponent>;
+
+            std::size_t const id = registry::component_index<TComponent>( );
+            pool_type const* pool = id < registry.pools_.size( ) && registry.pools_[id].has_value( )
+                                        ? &static_cast<pool_type const&>( *registry.pools_[id] )
+                                        : nullptr;
+
+            if constexpr ( pool_type::is_pointer_stable )
+            {
+                // leave the tombstones out, a loaded set starts compact
+                std::vector<entity_type> entities{};
+                std::vector<TComponent> elements{};
+                std::vector<tick_type> added{};
+                std::vector<tick_type> changed{};
+                if ( pool != nullptr )
+                {
+                    for ( std::size_t pos = 0U; pos < pool->packed( ).size( ); ++pos )
+                    {
+                        entity_type const entity = pool->packed( )[pos];
+                        if ( entity == pool_type::tombstone ) { continue; }
+
+                        entities.push_back( entity );
+                        elements.push_back( pool->unsafe_get( entity ) );
+                        if constexpr ( pool_type::is_tick_tracked )
+                        {
+                            added.push_back( pool->added_ticks( )[pos] );
+                            changed.push_back( pool->changed_ticks( )[pos] );
+                        }
+                    }
+                }
+                write_pool<TComponent>( output, entities, elements, added, changed );
+            }
+            else if ( pool == nullptr )
+            {
+                write_pool<TComponent>( output, { }, { }, { }, { } );
+            }
+            else if constexpr ( pool_type::is_tick_tracked )
+            {
+                write_pool<TComponent>( output, pool->packed( ), data_of( *pool ), pool->added_ticks( ), pool->changed_ticks( ) );
+            }
+            else
+            {
+                write_pool<TComponent>( output, pool->packed( ), data_of( *pool ), { }, { } );
+            }
+        }
+
+
+        template <typename TPool>
+        [[nodiscard]] static auto data_of( TPool const& pool ) noexcept -> std::span<typename TPool::value_type const>
+        {
+            if constexpr ( TPool::is_tag_set ) { return { }; }
+            else { return pool.data( ); }
+        }
+
+
+        template <detail::ecs_component TComponent, snapshot_output TOutput>
+        static auto write_pool(
+            TOutput& output, std::span<entity_type const> const entities, std::span<TComponent const> const elements,
+            std::span<tick_type const> const added, std::span<tick_type const> const changed ) -> void
+        {
+            pool_header const header{
+                meta::hash::type_hash_v<TComponent>, element_size<TComponent>( ),
+                detail::reg_pool_type<TComponent>::is_tick_tracked ? 1U : 0U, entities.size( )
+            };
+            write_array( output, std::span{ &header, 1U } );
+            write_array( output, entities );
+            if constexpr ( not detail::reg_pool_type<TComponent>::is_tag_set ) { write_array( output, elements ); }
+            if constexpr ( detail::reg_pool_type<TComponent>::is_tick_tracked )
+            {
+                write_array( output, added );
+                write_array( output, changed );
+            }
+        }
+
+
+        /**
+         * @brief Whether @count values of @size bytes, a count read from the input, can be in it: their size must
+         * not overflow, nor exceed what is left of inputs that know it.
+         */
+        template <snapshot_input TInput>
+        [[nodiscard]] static auto fits( TInput const& input, uint64_t const count, std::size_t const size ) noexcept -> bool
+        {
+            if ( size == 0U ) { return true; }
+            if ( count > ( std::numeric_limits<std::size_t>::max( ) - alignment ) / size ) { return false; }
+            if constexpr ( requires { { input.remaining( ) } -> std::same_as<std::size_t>; } )
+            {
+                return static_cast<std::size_t>( count ) * size <= input.remaining( );
+            }
+            else { return true; }
+        }
+
+
+        template <typename T, snapshot_input TInput>
+        [[nodiscard]] static auto read_value( TInput& input, T& value ) -> bool
+        {
+            return input.read( std::as_writable_bytes( std::span{ &value, 1U } ) ) &&
+                   input.skip( padded( sizeof( T ) ) - sizeof( T ) );
+        }
+
+
+        /**
+         * @brief Views the next @count values of the input, straight from its memory when it has any and the values
+         * are aligned there, copied into @scratch otherwise.
+         */
+        template <typename T, snapshot_input TInput>
+        [[nodiscard]] static auto read_array(
+            TInput& input, std::size_t const count, std::vector<std::byte>& scratch ) -> std::optional<std::span<T const>>
+        {
+            if ( not fits( input, count, sizeof( T ) ) ) { return std::nullopt; }
+
+            std::size_t const bytes = count * sizeof( T );
+            std::span<std::byte const> source{ };
+            if constexpr ( requires { { input.take( bytes ) } -> std::same_as<std::span<std::byte const>>; } )
+            {
+                source = input.take( padded( bytes ) );
+                if ( source.size( ) != padded( bytes ) ) { return std::nullopt; }
+            }
+            if ( source.empty( ) || reinterpret_cast<std::uintptr_t>( source.data( ) ) % alignof( T ) != 0U )
+            {
+                scratch.resize( bytes );
+                if ( not source.empty( ) ) { std::memcpy( scratch.data( ), source.data( ), bytes ); }
+                else if ( not input.read( scratch ) || not input.skip( padded( bytes ) - bytes ) ) { return std::nullopt; }
+                source = scratch;
+            }
+            return std::span{ reinterpret_cast<T const*>( source.data( ) ), count };
+        }
+
+
+        template <detail::ecs_component... TComponents, snapshot_input TInput>
+        static auto load_impl( registry& registry, TInput& input ) -> std::expected<void, ecs_error>
+        {
+            file_header header{ };
+            if ( not read_value( input, header ) || header.magic != magic ) { return std::unexpected{ ecs_error::invalid_snapshot }; }
+            if ( header.version != format_version ) { return std::unexpected{ ecs_error::snapshot_version_mismatch }; }
+            if ( header.entity_size != sizeof( entity_type ) ) { return std::unexpected{ ecs_error::snapshot_layout_mismatch }; }
+            if ( header.slot_count == 0U || header.slot_count > uint64_t{ entity_traits::max_index } + 1U ||
+                 header.free_count >= header.slot_count ||
+                 not fits( input, header.slot_count + header.free_count, sizeof( entity_type ) ) )
+            {
+                return std::unexpected{ ecs_error::invalid_snapshot };
+            }
+
+            registry.entity_alloc_.clear( );
+
+            // the allocator's arrays are read in place, its batches are scratch and start empty
+            entity_allocator& entities = registry.entity_alloc_;
+            entities.slots_.resize( header.slot_count );
+            entities.free_handles_.resize( header.free_count );
+            if ( not input.read( std::as_writable_bytes( std::span{ entities.slots_ } ) ) ||
+                 not input.skip( padded( header.slot_count * sizeof( entity_type ) ) - header.slot_count * sizeof( entity_type ) ) ||
+                 not input.read( std::as_writable_bytes( std::span{ entities.free_handles_ } ) ) ||
+                 not input.skip( padded( header.free_count * sizeof( entity_type ) ) - header.free_count * sizeof( entity_type ) ) )
+            {
+                return std::unexpected{ ecs_error::invalid_snapshot };
+            }
+
+            // a live slot holds an entity of its own index, and the reserved slot 0 holds none, or alive( ) and the
+            // pools would disagree on which slot an entity lives in
+            for ( std::size_t index = 0U; index < entities.slots_.size( ); ++index )
+            {
+                entity_type const slot = entities.slots_[index];
+                if ( slot != null_entity && ( index == 0U || entity_traits::to_index( slot ) != index ) )
+                {
+                    return std::unexpected{ ecs_error::invalid_snapshot };
+                }
+            }
+
+            // a free handle names a dead slot, or create( ) would hand out a live entity again, and names it once, or
+            // create( ) would hand out the same entity twice. Each checked slot is marked with its handle so a duplicate
+            // finds it taken, a failed load is cleared by the caller
+            for ( entity_type const handle : entities.free_handles_ )
+            {
+                entity_traits::index_type const index = entity_traits::to_index( handle );
+                if ( index == 0U || index >= entities.slots_.size( ) || entities.slots_[index] != null_entity )
+                {
+                    return std::unexpected{ ecs_error::invalid_snapshot };
+                }
+                entities.slots_[index] = handle;
+            }
+            for ( entity_type const handle : entities.free_handles_ )
+            {
+                entities.slots_[entity_traits::to_index( handle )] = null_entity;
+            }
+            registry.tick_.store( header.tick, std::memory_order_relaxed );
+
+            using load_fn = auto ( * )( ecs::registry&, TInput&, pool_header const&, load_buffers& ) -> std::expected<void, ecs_error>;
+            static constexpr std::array<std::pair<meta::hash::hash_type, load_fn>, sizeof...( TComponents )> loaders{
+                { { meta::hash::type_hash_v<TComponents>, &load_pool<TComponents, TInput> }... }
+            };
+
+            load_buffers buffers{ };
+            for ( uint32_t pool = 0U; pool < header.pool_count; ++pool )
+            {
+                pool_header section{ };
+                if ( not read_value( input, section ) ||
+                     not fits( input, section.count, sizeof( entity_type ) + section.element_size +
+                                                    ( section.has_ticks != 0U ? 2U * sizeof( tick_type ) : 0U ) ) )
+                {
+                    return std::unexpected{ ecs_error::invalid_snapshot };
+                }
+
+                if ( auto const it = std::ranges::find( loaders, section.type_hash, &std::pair<meta::hash::hash_type, load_fn>::first );
+                     it != loaders.end( ) )
+                {
+                    if ( auto const loaded = it->second( registry, input, section, buffers ); not loaded.has_value( ) )
+                    {
+                        return loaded;
+                    }
+                }
+                else if ( not input.skip( section_size( section ) ) )
+                {
+                    return std::unexpected{ ecs_error::invalid_snapshot };
+                }
+            }
+
+            for ( auto& group : registry.groups_ )
+            {
+                group->regroup( );
+            }
+            return { };
+        }
+
+
+        [[nodiscard]] static auto section_size( pool_header const& section ) noexcept -> std::size_t
+        {
+            std::size_t const count = static_cast<std::size_t>( section.count );
+            return padded( count * sizeof( entity_type ) ) + padded( count * section.element_size ) +
+                   ( section.has_ticks != 0U ? 2U * padded( count * sizeof( tick_type ) ) : 0U );
+        }
+
+
+        template <detail::ecs_component TComponent, snapshot_input TInput>
+        static auto load_pool(
+            registry& registry, TInput& input, pool_header const& section, load_buffers& buffers ) -> std::expected<void, ecs_error>
+        {
+            using pool_type = detail::reg_pool_type<TComponent>;
+
+            if ( section.element_size != element_size<TComponent>( ) )
+            {
+                return std::unexpected{ ecs_error::snapshot_layout_mismatch };
+            }
+
+            std::size_t const count = static_cast<std::size_t>( section.count );
+            auto const entities = read_array<entity_type>( input, count, buffers.entities );
+            auto const elements = pool_type::is_tag_set
+                                      ? std::optional{ std::span<TComponent const>{ } }
+                                      : read_array<TComponent>( input, count, buffers.elements );
+            if ( not entities.has_value( ) || not elements.has_value( ) ) { return std::unexpected{ ecs_error::invalid_snapshot }; }
+
+            std::optional<std::span<tick_type const>> added{ std::span<tick_type const>{ } };
+            std::optional<std::span<tick_type const>> changed{ std::span<tick_type const>{ } };
+            if ( section.has_ticks != 0U )
+            {
+                // ticks of a pool that stopped tracking them are read and dropped
+                added   = read_array<tick_type>( input, count, buffers.added );
+                changed = read_array<tick_type>( input, count, buffers.changed );
+                if ( not added.has_value( ) || not changed.has_value( ) ) { return std::unexpected{ ecs_error::invalid_snapshot }; }
+            }
+
+            // every entity must be alive and in the pool once. The signatures are marked first to catch duplicates, a
+            // rejected snapshot clears them along with the pools
+            meta::sequential_index_type const id = registry::component_index<TComponent>( );
+            for ( entity_type const entity : *entities )
+            {
+                if ( not registry.entity_alloc_.alive( entity ) || registry.signatures_.set( entity_traits::to_index( entity ), id ) )
+                {
+                    return std::unexpected{ ecs_error::invalid_snapshot };
+                }
+            }
+
+            pool_type& pool = registry.ensure_pool<TComponent>( );
+            if constexpr ( pool_type::is_tick_tracked ) { pool.append( *entities, *elements, *added, *changed ); }
+            else { pool.append( *entities, *elements ); }
+            return { };
+        }
+    };
+}
+
+
+#endif //!RST_ECS_SNAPSHOT_H
@@ -0,0 +1,180 @@
+#ifndef RST_ECS_STAGING_AREA_H
+#define RST_ECS_STAGING_AREA_H
+
+#include <rst/pch.h>
+
+#include <rst/__core/__ecs/command_buffer.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/entity.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief Lets threads other than the main one create entities and emplace components, merged into the registry
+     * at a point of the frame where nothing iterates it.
+     *
+     * Every thread records into a command_buffer of its own, a slot claimed the first time the thread writes. The
+     * main thread merges all of them in a single batched pass (see merge), which hare does once per frame, before
+     * the systems run. Recording never touches the registry, and the frame only pays for the merge: one atomic
+     * load when nothing was staged.
+     *
+     * @code
+     * // on the asset streaming thread
+     * {
+     *     auto writer = engine.staging( ).write( );
+     *     for ( auto const& tile : chunk.tiles ) {
+     *         deferred_entity const entity = writer.create( );
+     *         writer.emplace<transform>( entity, tile.position );
+     *         writer.emplace<sprite>( entity, tile.sprite );
+     *     }
+     * } // the tiles show up at the start of the next frame
+     * @endcode
+     *
+     * @note A slot is guarded by a mutex, held by its writer and for a moment by merge: writers never wait for
+     * one another, and merge never waits at all, it leaves the slots of open writers for the next one. The main
+     * thread takes no lock outside of merge. Threads past the slot capacity share slots.
+     */
+    class staging_area final
+    {
+    public:
+        class writer;
+
+
+        /**
+         * Slots allocated by default: the hardware threads, plus a few for loader and streaming threads.
+         */
+        [[nodiscard]] static auto default_slot_count( ) noexcept -> std::size_t;
+
+        /**
+         * @param slot_count Number of threads that get a slot of their own.
+         */
+        explicit staging_area( std::size_t slot_count = default_slot_count( ) );
+        ~staging_area( ) noexcept;
+
+        staging_area( staging_area const& )                        = delete;
+        staging_area( staging_area&& ) noexcept                    = delete;
+        auto operator=( staging_area const& ) -> staging_area&     = delete;
+        auto operator=( staging_area&& ) noexcept -> staging_area& = delete;
+
+        /**
+         * @brief Opens the calling thread's slot for writing, until the writer is destroyed.
+         *
+         * @complexity O(1), the first call of a thread claims its slot
+         * @return The writer, keep it for a batch of entities rather than for a single command.
+         * @note Thread safe. A thread has at most one writer open per area: a second one would wait on the slot
+         * the first holds, forever.
+         */
+        [[nodiscard]] auto write( ) -> writer;
+
+        /**
+         * @brief Applies what every thread staged to @registry, in one playback: each pool is reserved and filled
+         * once for all threads.
+         *
+         * @complexity O(c log c) where c is the number of staged commands, plus the registry operations. O(1) if
+         * nothing was staged since the last merge.
+         * @param registry The registry to apply the staged commands to. No view of it may be iterating.
+         * @note Call it from the thread that owns @registry. The slots of writers still open are skipped, their
+         * commands go to the next merge.
+         */
+        auto merge( registry& registry ) -> void;
+
+        /**
+         * @return True if something was staged since the last merge.
+         */
+        [[nodiscard]] auto pending( ) const noexcept -> bool;
+
+
+        /**
+         * @brief Records entity creations and component emplacements into the calling thread's slot.
+         *
+         * @note Deferred handles are valid until the writer is destroyed, a merge may run as soon as it is.
+         */
+        class writer final
+        {
+            friend class staging_area;
+
+        public:
+            ~writer( ) noexcept;
+
+            writer( writer const& )                        = delete;
+            writer( writer&& ) noexcept                    = delete;
+            auto operator=( writer const& ) -> writer&     = delete;
+            auto operator=( writer&& ) noexcept -> writer& = delete;
+
+            /**
+             * @brief Stages the creation of an entity.
+             * @complexity O(1)
+             * @return A handle to refer to the entity in later calls of this writer.
+             */
+            [[nodiscard]] auto create( ) noexcept -> deferred_entity
+            {
+                return commands_ref_.create( );
+            }
+
+
+            /**
+             * @brief Stages the addition of a TComponent, constructed now from @args, to an entity created by this
+             * writer.
+             *
+             * @complexity O(1) amortized, plus the copy of the component
+             * @tparam TComponent The component type to emplace.
+             * @param entity The deferred entity to attach the component to.
+             * @param args Constructor arguments forwarded to TComponent's constructor.
+             */
+            template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
+            auto emplace( deferred_entity const entity, TArgs&&... args ) -> void
+            {
+                commands_ref_.emplace<TComponent>( entity, std::forward<TArgs>( args )... );
+            }
+
+
+            /**
+             * @brief Stages the addition (or replacement) of a TComponent to an entity of the registry. Dropped at
+             * merge if the entity is dead by then.
+             *
+             * @complexity O(1) amortized, plus the copy of the component
+             * @tparam TComponent The component type to emplace.
+             * @param entity The entity to attach the component to.
+             * @param args Constructor arguments forwarded to TComponent's constructor.
+             */
+            template <detail::ecs_component TComponent, typename... TArgs> requires std::constructible_from<TComponent, TArgs...>
+            auto emplace( entity_type const entity, TArgs&&... args ) -> void
+            {
+                commands_ref_.emplace<TComponent>( entity, std::forward<TArgs>( args )... );
+            }
+
+        private:
+            uint64_t const area_id_;
+            std::unique_lock<std::mutex> lock_;
+            command_buffer& commands_ref_;
+            std::atomic<bool>& pending_ref_;
+
+            writer( uint64_t area_id, std::mutex& mutex, command_buffer& commands, std::atomic<bool>& pending );
+        };
+
+    private:
+        struct alignas( 64 ) slot final
+        {
+            std::mutex mutex{};
+            command_buffer commands{};
+        };
+
+
+        // identifies the area in the slot cache of each thread, addresses get reused
+        uint64_t const id_;
+
+        std::vector<std::unique_ptr<slot>> slots_{};
+        std::atomic<std::size_t> claimed_slots_{ 0U };
+        std::atomic<bool> pending_{ false };
+
+        // every slot appended, played back at once. Main thread only
+        command_buffer merged_{};
+
+
+        [[nodiscard]] auto slot_of_current_thread( ) -> slot&;
+    };
+}
+
+
+#endif //!RST_ECS_STAGING_AREA_H
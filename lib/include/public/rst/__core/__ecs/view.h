@@ -5,11 +5,14 @@
 
 #include <rst/diagnostic.h>
 #include <rst/data_type/sparse_set.h>
+#include <rst/data_type/worker_pool.h>
 #include <rst/meta/type_traits.h>
 #include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/component_traits.h>
 #include <rst/__core/__ecs/ecs_error.h>
 #include <rst/__core/__ecs/entity.h>
 #include <rst/__core/__ecs/registry_pool.h>
+#include <rst/__core/__ecs/view_filter.h>
 
 
 namespace rst::ecs
@@ -51,18 +54,20 @@ namespace rst::ecs
          * - clear() - fully invalidates the iterator
          * - reserve() - safe (only pre-allocates, doesn't move existing elements)
          * - Modifying component data through the yielded references is always safe
+         * Record structural changes in an ecs::command_buffer and play it back after the loop instead.
          *
          * @tparam TView The view type this iterator operates on
-         * @tparam TComponents The component types being iterated over
+         * @tparam TComponents The component types being iterated over, optional ones yield pointers
          */
-        template <typename TView, detail::viewable_ecs_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
+        template <typename TView, detail::view_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
         class view_range_iterator
         {
         public:
             using value_type = std::conditional_t<std::is_const_v<TView>,
-                std::tuple<entity_type, TComponents const&...>, std::tuple<entity_type, TComponents&...>>;
+                std::tuple<entity_type, detail::view_reference_t<TComponents const>...>,
+                std::tuple<entity_type, detail::view_reference_t<TComponents>...>>;
 
-            using underlying_iterator_type = sparse_intersection_iterator<entity_type, TComponents...>;
+            using underlying_iterator_type = std::remove_const_t<TView>::iterator_type;
 
 
             view_range_iterator( ) = default;
@@ -76,9 +81,12 @@ namespace rst::ecs
             [[nodiscard]] auto operator*( ) const -> value_type
             {
                 entity_type const entity = *it_;
-                return std::tuple_cat(
-                    std::forward_as_tuple( entity ),
-                    meta::wrap_unique( view_ref_.template get<TComponents...>( entity ).value( ) ) );
+                // one component at a time, a single component comes back as a ref_proxy
+                return value_type{
+                    entity,
+                    static_cast<std::tuple_element_t<meta::index_of_v<TComponents, TComponents...> + 1U, value_type>>(
+                        view_ref_.template unsafe_get<TComponents>( entity ) )...
+                };
             }
 
 
@@ -118,9 +126,13 @@ namespace rst::ecs
      * - Lazy evaluation - entities are checked during iteration.
      * - Cache-friendly iteration using packed arrays.
      * - Multiple iteration patterns via each() overloads.
+     * - Chunked structure-of-arrays iteration via each_chunk(), contiguous spans with no per-entity lookup.
      * - Compile-time type safety with subset component access.
      * - Support for both mutable and const access patterns.
      * - Range-based for loop support with structured bindings.
+     * - added<T> and changed<T> filters for incremental systems, scanning the pivot's tick array.
+     * - Mutable access marks change-tracked components as changed, untracked( ) opts out.
+     * - exclude<T...> to skip the entities with any of T, optional<T> to hand out T* without requiring it.
      *
      * @code
      * // basic view usage for system processing
@@ -167,26 +179,65 @@ namespace rst::ecs
      * if (view.has<position, velocity>(some_entity)) {
      *     // entity has both components in this view
      * }
+     *
+     * // method 5: chunked structure-of-arrays iteration, the inner loop can be vectorised
+     * view.each_chunk([](std::span<position> positions, std::span<velocity const> velocities) {
+     *     for (std::size_t i = 0; i < positions.size(); ++i) {
+     *         positions[i].x += velocities[i].dx;
+     *         positions[i].y += velocities[i].dy;
+     *     }
+     * });
+     *
+     * // method 6: only the entities whose transform changed since the system last ran
+     * registry.view<sprite const, changed<transform>>(last_run_tick()).each([](sprite const& s) {
+     *     // re-upload s
+     * });
+     *
+     * // method 7: skip frozen entities, velocity is handed out only where present
+     * registry.view<position, optional<velocity const>, exclude<frozen>>().each([](position& pos, velocity const* vel) {
+     *     if (vel) { pos.x += vel->dx; }
+     * });
      * @endcode
      *
-     * @tparam TComponents The component types that entities must possess.
+     * @tparam TComponents The component types that entities must possess, optional<T> ones are handed out as T*.
+     * @tparam TFilters Tick filters the entities must also pass, without being handed to the delegates.
+     * @tparam TExcluded The component types that entities must not possess.
      */
-    template <detail::viewable_ecs_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
-    class view final
+    template <typename TComponentList, typename TFilterList, typename TExcludeList>
+    class basic_view;
+
+
+    template <detail::view_component... TComponents, detail::tick_filter... TFilters, detail::viewable_ecs_component... TExcluded>
+        requires ( not detail::view_component_traits<TComponents>::is_optional || ... )
+    class basic_view<meta::type_list<TComponents...>, meta::type_list<TFilters...>, meta::type_list<TExcluded...>> final
     {
+        static constexpr bool is_tick_filtered{ sizeof...( TFilters ) > 0U };
+        static constexpr bool has_optionals{ ( detail::view_component_traits<TComponents>::is_optional || ... ) };
+        // anything past plain required components is checked by the view itself, with the concrete pool types
+        static constexpr bool is_filtered{ is_tick_filtered || has_optionals || sizeof...( TExcluded ) > 0U };
+
     public:
-        using iterator_type       = sparse_intersection_iterator<entity_type, TComponents...>;
-        using const_iterator_type = sparse_intersection_iterator<entity_type, TComponents...>;
+        class filtered_iterator;
+
+        using component_list = meta::type_list<TComponents...>;
+        using filter_list    = meta::type_list<TFilters...>;
+        using exclude_list   = meta::type_list<TExcluded...>;
+
+        using iterator_type = std::conditional_t<
+            is_filtered, filtered_iterator, sparse_intersection_iterator<entity_type, TComponents...>>;
+        using const_iterator_type = iterator_type;
 
         template <typename... UComponents>
         using underlying_view_get_type =
-        meta::unwrap_single<typename meta::fallback<std::tuple, UComponents&...>::template if_empty<TComponents&...>::type>::type;
+        meta::unwrap_single<typename meta::fallback<std::tuple, detail::view_reference_t<UComponents>...>::template if_empty<
+            detail::view_reference_t<TComponents>...>::type>::type;
 
         /**
          * The return type of get() based on requested component types.
          * - If no types are specified, returns a tuple of all component references.
          * - If a single type is specified, returns a direct reference to that component.
          * - If multiple types are specified, returns a tuple of those component references.
+         * Optional components are pointers, null if the entity lacks them.
          * @tparam UComponents
          */
         template <typename... UComponents>
@@ -232,16 +283,99 @@ namespace rst::ecs
         };
 
 
+        /**
+         * @brief Iterator over the entities of a view with filters, exclusions or optional components.
+         *
+         * Walks the pivot and checks every other pool through its concrete type. With tick filters the pivot is a
+         * pool of one of them and its tick array is read first, so that untouched elements cost a single compare.
+         * Same invalidation rules as sparse_intersection_iterator.
+         */
+        class filtered_iterator final
+        {
+        public:
+            filtered_iterator( basic_view const& view, std::size_t const pos ) noexcept
+                : view_ptr_{ &view }
+                , pos_{ view.next_match( pos ) } { }
+
+
+            [[nodiscard]] auto operator*( ) const noexcept -> entity_type
+            {
+                return view_ptr_->smallest_pool_ref_.packed( )[pos_];
+            }
+
+
+            auto operator++( ) noexcept -> filtered_iterator&
+            {
+                pos_ = view_ptr_->next_match( pos_ + 1U );
+                return *this;
+            }
+
+
+            auto operator++( int ) noexcept -> filtered_iterator
+            {
+                auto temp = *this;
+                ++( *this );
+                return temp;
+            }
+
+
+            [[nodiscard]] auto operator==( filtered_iterator const& other ) const noexcept -> bool { return pos_ == other.pos_; }
+            [[nodiscard]] auto operator!=( filtered_iterator const& other ) const noexcept -> bool { return pos_ != other.pos_; }
+
+        private:
+            basic_view const* view_ptr_;
+            std::size_t pos_;
+        };
+
+
         /**
          * @brief Constructs a view from component pools.
          *
-         * @param pools Tuple of component pool references for the required component types.
+         * The pivot, the pool the view walks, is the smallest required component pool, or the smallest filtered
+         * pool if the view has tick filters.
          *
-         * @complexity O(1)
+         * @param pools Component pool references for the component types, optional ones included.
+         * @param filter_pools Pool references for the component type of each filter.
+         * @param excluded_pools Pool references for the excluded component types.
+         * @param since Filters match the components added or changed after this tick.
+         *
+         * @complexity O(k) where k is the number of component types.
          */
-        explicit view( detail::reg_pool_type<TComponents>&... pools ) noexcept
+        explicit basic_view(
+            detail::view_pool_type<TComponents>&... pools, detail::filter_pool_type<TFilters>&... filter_pools,
+            detail::reg_pool_type<TExcluded>&... excluded_pools, tick_type const since = 0U ) noexcept
             : pools_{ pools... }
-            , smallest_pool_ref_{ *meta::find_smallest<base_sparse_set<entity_type>>( pools_ ) } { }
+            , filter_pools_{ filter_pools... }
+            , excluded_pools_{ excluded_pools... }
+            , smallest_pool_ref_{ pick_pivot( ) }
+            , since_{ since }
+        {
+            if constexpr ( is_tick_filtered )
+            {
+                [this]<std::size_t... filter_ids>( std::index_sequence<filter_ids...> )
+                {
+                    static_cast<void>( ( try_pivot_ticks<filter_ids>( ) || ... ) );
+                }( std::index_sequence_for<TFilters...>{ } );
+            }
+        }
+
+
+        /**
+         * @brief Returns a copy of the view whose mutable accesses leave the change ticks untouched.
+         *
+         * For systems writing a change-tracked component without the write meaning a change, e.g. caches derived
+         * from the component itself.
+         *
+         * @return The untracked view.
+         *
+         * @complexity O(1)
+         */
+        [[nodiscard]] auto untracked( ) const noexcept -> basic_view
+        {
+            basic_view copy{ *this };
+            copy.marks_changes_ = false;
+            return copy;
+        }
 
 
         /**
@@ -249,7 +383,7 @@ namespace rst::ecs
          *
          * @tparam UComponents Component types to check (must be a decayed subset of TComponents).
          * @param entity The entity to check.
-         * @return True if entity has all specified components, false otherwise.
+         * @return True if entity has all specified components, optional ones included, false otherwise.
          *
          * @complexity O(k) where k is the number of UComponents.
          * @note UComponents must be a subset of TComponents.
@@ -278,7 +412,7 @@ namespace rst::ecs
         template <typename... UComponents> requires ( meta::contains_type<UComponents, TComponents...> && ... )
         [[nodiscard]] auto get( entity_type const entity ) noexcept -> view_get_type<UComponents...>
         {
-            return get_impl<view_get_type<UComponents...>, UComponents...>( entity );
+            return get_impl<view_get_type<UComponents...>, false, UComponents...>( entity );
         }
 
 
@@ -299,7 +433,7 @@ namespace rst::ecs
         template <meta::contains_type<TComponents...>... UComponents>
         [[nodiscard]] auto get( entity_type const entity ) const noexcept -> view_get_type<UComponents const...>
         {
-            return get_impl<view_get_type<UComponents const...>, UComponents...>( entity );
+            return get_impl<view_get_type<UComponents const...>, true, UComponents...>( entity );
         }
 
 
@@ -319,8 +453,8 @@ namespace rst::ecs
         template <meta::contains_type<TComponents...>... UComponents>
         [[nodiscard]] auto unsafe_get( entity_type const entity ) noexcept -> underlying_view_get_type<UComponents...>
         {
-            ensure( has<UComponents...>( entity ), "entity not found!" );
-            return get_impl<underlying_view_get_type<UComponents...>, UComponents...>( entity );
+            ensure( ( contains<UComponents>( entity ) && ... ), "entity not found!" );
+            return get_impl<underlying_view_get_type<UComponents...>, false, UComponents...>( entity );
         }
 
 
@@ -340,23 +474,23 @@ namespace rst::ecs
         template <meta::contains_type<TComponents...>... UComponents>
         [[nodiscard]] auto unsafe_get( entity_type const entity ) const noexcept -> underlying_view_get_type<UComponents const...>
         {
-            ensure( has<UComponents...>( entity ), "entity not found!" );
-            return get_impl<underlying_view_get_type<UComponents const...>, UComponents...>( entity );
+            ensure( ( contains<UComponents>( entity ) && ... ), "entity not found!" );
+            return get_impl<underlying_view_get_type<UComponents const...>, true, UComponents...>( entity );
         }
 
 
         /**
          * @brief Applies a function to each entity with entity ID and mutable component references.
          *
-         * @tparam TDelegate Function type that accepts (entity_type, TComponents&...).
+         * @tparam TDelegate Function type that accepts (entity_type, TComponents&...), T* for optional<T>.
          * @param delegate Function to apply to each entity and its components.
          *
          * @complexity O(n×k) where n is the number of matching entities, k is the number of components.
          */
-        template <std::invocable<entity_type, TComponents&...> TDelegate>
+        template <std::invocable<entity_type, detail::view_reference_t<TComponents>...> TDelegate>
         auto each( TDelegate&& delegate ) noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
         {
-            each_impl<true>( std::forward<TDelegate>( delegate ) );
+            each_impl<true, false>( std::forward<TDelegate>( delegate ) );
         }
 
 
@@ -368,10 +502,10 @@ namespace rst::ecs
          *
          * @complexity O(n×k) where n is the number of matching entities, k is the number of components.
          */
-        template <std::invocable<TComponents&...> TDelegate>
+        template <std::invocable<detail::view_reference_t<TComponents>...> TDelegate>
         auto each( TDelegate&& delegate ) noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
         {
-            each_impl<false>( std::forward<TDelegate>( delegate ) );
+            each_impl<false, false>( std::forward<TDelegate>( delegate ) );
         }
 
 
@@ -383,10 +517,10 @@ namespace rst::ecs
          *
          * @complexity O(n×k) where n is the number of matching entities, k is the number of components.
          */
-        template <std::invocable<entity_type, TComponents const&...> TDelegate>
+        template <std::invocable<entity_type, detail::view_reference_t<TComponents const>...> TDelegate>
         auto each( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
         {
-            each_impl<true>( std::forward<TDelegate>( delegate ) );
+            each_impl<true, true>( std::forward<TDelegate>( delegate ) );
         }
 
 
@@ -398,10 +532,178 @@ namespace rst::ecs
          *
          * @complexity O(n×k) where n is the number of matching entities, k is the number of components.
          */
-        template <std::invocable<TComponents const&...> TDelegate>
+        template <std::invocable<detail::view_reference_t<TComponents const>...> TDelegate>
         auto each( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
         {
-            each_impl<false>( std::forward<TDelegate>( delegate ) );
+            each_impl<false, true>( std::forward<TDelegate>( delegate ) );
+        }
+
+
+        /**
+         * @brief Applies a function to contiguous chunks of matching entities and their components.
+         *
+         * Each call receives spans of equal length: the entities of the chunk and, for every component type, the
+         * components of those entities in the same order. A chunk is a run where the packed order of every pool
+         * lines up with the smallest pool, so components are handed out straight from the pools' storage: no
+         * copies and no sparse lookup past the first entity of the chunk. Pools filled in the same order (or kept
+         * packed together) yield a single chunk; unrelated orders degrade to chunks of one entity. Pointer-stable
+         * pools store their components one page at a time, their chunks end at page boundaries and tombstones.
+         *
+         * @code
+         * view.each_chunk([](std::span<entity_type const> entities, std::span<position> positions, std::span<velocity> velocities) {
+         *     for (std::size_t i = 0; i < entities.size(); ++i) {
+         *         positions[i].x += velocities[i].dx;
+         *     }
+         * });
+         * @endcode
+         *
+         * @tparam TDelegate Function type that accepts (std::span<entity_type const>, std::span<TComponents>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(n×k) where n is the number of entities in the smallest pool, k is the number of components.
+         * @note The spans point into the pools: adding or removing any of the viewed components inside the delegate
+         * invalidates them. Modifying component values is always safe. Not available with optional components.
+         */
+        template <std::invocable<std::span<entity_type const>, std::span<TComponents>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+            requires ( not has_optionals )
+        {
+            each_chunk_impl<true, false>( std::forward<TDelegate>( delegate ) );
+        }
+
+
+        /**
+         * @brief Applies a function to contiguous chunks of matching components, without the entities.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<TComponents>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(n×k) where n is the number of entities in the smallest pool, k is the number of components.
+         * @note See the entity overload for chunking and invalidation rules.
+         */
+        template <std::invocable<std::span<TComponents>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+            requires ( not has_optionals )
+        {
+            each_chunk_impl<false, false>( std::forward<TDelegate>( delegate ) );
+        }
+
+
+        /**
+         * @brief Applies a function to contiguous chunks of matching entities and their const components.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<entity_type const>, std::span<TComponents const>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(n×k) where n is the number of entities in the smallest pool, k is the number of components.
+         * @note See the mutable overload for chunking and invalidation rules.
+         */
+        template <std::invocable<std::span<entity_type const>, std::span<TComponents const>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+            requires ( not has_optionals )
+        {
+            each_chunk_impl<true, true>( std::forward<TDelegate>( delegate ) );
+        }
+
+
+        /**
+         * @brief Applies a function to contiguous chunks of matching const components, without the entities.
+         *
+         * @tparam TDelegate Function type that accepts (std::span<TComponents const>...).
+         * @param delegate Function to apply to each chunk.
+         *
+         * @complexity O(n×k) where n is the number of entities in the smallest pool, k is the number of components.
+         * @note See the mutable overload for chunking and invalidation rules.
+         */
+        template <std::invocable<std::span<TComponents const>...> TDelegate>
+        auto each_chunk( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+            requires ( not has_optionals )
+        {
+            each_chunk_impl<false, true>( std::forward<TDelegate>( delegate ) );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with entity ID and mutable component references, in parallel.
+         *
+         * The packed range of the smallest pool is split into chunks whose boundaries fall on cache line
+         * multiples of the entity array, and the chunks run on @pool, the calling thread included. The call
+         * returns once every entity has been visited. Entities are not visited in packed order.
+         *
+         * @code
+         * view.par_each(services.worker_pool(), [](transform& tf, velocity const& vel) {
+         *     tf.translate(vel.direction * vel.speed);
+         * });
+         * @endcode
+         *
+         * @tparam TDelegate Function type that accepts (entity_type, TComponents&...), called concurrently.
+         * @param pool The pool running the chunks.
+         * @param delegate Function to apply to each entity and its components.
+         *
+         * @complexity O(n×k / t) where n is the size of the smallest pool, k the number of components and t the
+         * number of threads of @pool.
+         * @note The delegate may only write to the components it is handed. Creating or destroying entities,
+         * adding or removing components, or reading other entities' components during the pass is a data race:
+         * record structural changes in one command_buffer per thread and play them back after the call returns.
+         */
+        template <std::invocable<entity_type, detail::view_reference_t<TComponents>...> TDelegate>
+        auto par_each( thread::worker_pool& pool, TDelegate&& delegate ) -> void
+        {
+            par_each_impl<true, false>( pool, delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with mutable component references only, in parallel.
+         *
+         * @tparam TDelegate Function type that accepts (TComponents&...), called concurrently.
+         * @param pool The pool running the chunks.
+         * @param delegate Function to apply to each entity's components.
+         *
+         * @complexity O(n×k / t) where n is the size of the smallest pool, k the number of components and t the
+         * number of threads of @pool.
+         * @note See the entity overload for chunking and the threading contract.
+         */
+        template <std::invocable<detail::view_reference_t<TComponents>...> TDelegate>
+        auto par_each( thread::worker_pool& pool, TDelegate&& delegate ) -> void
+        {
+            par_each_impl<false, false>( pool, delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with entity ID and const component references, in parallel.
+         *
+         * @tparam TDelegate Function type that accepts (entity_type, TComponents const&...), called concurrently.
+         * @param pool The pool running the chunks.
+         * @param delegate Function to apply to each entity and its components.
+         *
+         * @complexity O(n×k / t) where n is the size of the smallest pool, k the number of components and t the
+         * number of threads of @pool.
+         * @note See the mutable overload for chunking and the threading contract.
+         */
+        template <std::invocable<entity_type, detail::view_reference_t<TComponents const>...> TDelegate>
+        auto par_each( thread::worker_pool& pool, TDelegate&& delegate ) const -> void
+        {
+            par_each_impl<true, true>( pool, delegate );
+        }
+
+
+        /**
+         * @brief Applies a function to each entity with const component references only, in parallel.
+         *
+         * @tparam TDelegate Function type that accepts (TComponents const&...), called concurrently.
+         * @param pool The pool running the chunks.
+         * @param delegate Function to apply to each entity's components.
+         *
+         * @complexity O(n×k / t) where n is the size of the smallest pool, k the number of components and t the
+         * number of threads of @pool.
+         * @note See the mutable overload for chunking and the threading contract.
+         */
+        template <std::invocable<detail::view_reference_t<TComponents const>...> TDelegate>
+        auto par_each( thread::worker_pool& pool, TDelegate&& delegate ) const -> void
+        {
+            par_each_impl<false, true>( pool, delegate );
         }
 
 
@@ -412,9 +714,9 @@ namespace rst::ecs
          *
          * @complexity O(1) - creates lightweight wrapper
          */
-        auto each( ) noexcept -> view_range<view>
+        auto each( ) noexcept -> view_range<basic_view>
         {
-            return view_range<view>{ *this };
+            return view_range<basic_view>{ *this };
         }
 
 
@@ -425,9 +727,9 @@ namespace rst::ecs
          *
          * @complexity O(1) - creates lightweight wrapper
          */
-        auto each( ) const noexcept -> view_range<view const>
+        auto each( ) const noexcept -> view_range<basic_view const>
         {
-            return view_range<view const>{ *this };
+            return view_range<basic_view const>{ *this };
         }
 
 
@@ -443,8 +745,15 @@ namespace rst::ecs
          */
         [[nodiscard]] auto begin( ) noexcept(std::is_nothrow_constructible_v<iterator_type>) -> iterator_type
         {
-            return std::apply(
-                [this]( auto&... pools ) { return iterator_type::begin( smallest_pool_ref_, pools... ); }, pools_ );
+            if constexpr ( is_filtered )
+            {
+                return iterator_type{ *this, 0U };
+            }
+            else
+            {
+                return std::apply(
+                    [this]( auto&... pools ) { return iterator_type::begin( smallest_pool_ref_, pools... ); }, pools_ );
+            }
         }
 
 
@@ -457,8 +766,15 @@ namespace rst::ecs
          */
         [[nodiscard]] auto end( ) noexcept(std::is_nothrow_constructible_v<iterator_type>) -> iterator_type
         {
-            return std::apply(
-                [this]( auto&... pools ) { return iterator_type::end( smallest_pool_ref_, pools... ); }, pools_ );
+            if constexpr ( is_filtered )
+            {
+                return iterator_type{ *this, smallest_pool_ref_.size( ) };
+            }
+            else
+            {
+                return std::apply(
+                    [this]( auto&... pools ) { return iterator_type::end( smallest_pool_ref_, pools... ); }, pools_ );
+            }
         }
 
 
@@ -471,8 +787,15 @@ namespace rst::ecs
          */
         [[nodiscard]] auto begin( ) const noexcept(std::is_nothrow_invocable_v<const_iterator_type>) -> const_iterator_type
         {
-            return std::apply(
-                [this]( auto const&... pools ) { return const_iterator_type::begin( smallest_pool_ref_, pools... ); }, pools_ );
+            if constexpr ( is_filtered )
+            {
+                return const_iterator_type{ *this, 0U };
+            }
+            else
+            {
+                return std::apply(
+                    [this]( auto const&... pools ) { return const_iterator_type::begin( smallest_pool_ref_, pools... ); }, pools_ );
+            }
         }
 
 
@@ -485,22 +808,202 @@ namespace rst::ecs
          */
         [[nodiscard]] auto end( ) const noexcept(std::is_nothrow_constructible_v<const_iterator_type>) -> const_iterator_type
         {
-            return std::apply(
-                [this]( auto const&... pools ) { return const_iterator_type::end( smallest_pool_ref_, pools... ); }, pools_ );
+            if constexpr ( is_filtered )
+            {
+                return const_iterator_type{ *this, smallest_pool_ref_.size( ) };
+            }
+            else
+            {
+                return std::apply(
+                    [this]( auto const&... pools ) { return const_iterator_type::end( smallest_pool_ref_, pools... ); }, pools_ );
+            }
         }
 
     private:
-        std::tuple<detail::reg_pool_type<TComponents>&...> const pools_;
+        // entities per cache line of the packed array, par_each chunks are a multiple of it so that no two threads
+        // share a line of the pivot's packed array
+        static constexpr std::size_t par_chunk_alignment_{ std::max( 64U / sizeof( entity_type ), std::size_t{ 1U } ) };
+        // chunks per thread, more than one lets threads that finish early steal from slower ones
+        static constexpr std::size_t par_chunks_per_thread_{ 4U };
+        // tags store no components, their chunks are handed out from a shared buffer of bounded length
+        static constexpr std::size_t max_chunk_length_{
+            std::min( {
+                ( detail::view_pool_type<TComponents>::is_tag_set
+                      ? detail::view_pool_type<TComponents>::tag_span_capacity
+                      : std::numeric_limits<std::size_t>::max( ) )...
+            } )
+        };
+        // pointer-stable pools leave tombstones in their packed arrays, which line up in two such pools
+        static constexpr bool has_stable_pools_{ ( detail::view_pool_type<TComponents>::is_pointer_stable || ... ) };
+
+        using pivot_ticks_fn = auto ( * )( basic_view const& ) noexcept -> std::span<tick_type const>;
+
+        std::tuple<detail::view_pool_type<TComponents>&...> const pools_;
+        std::tuple<detail::filter_pool_type<TFilters>&...> const filter_pools_;
+        std::tuple<detail::reg_pool_type<TExcluded>&...> const excluded_pools_;
         detail::base_reg_pool_type& smallest_pool_ref_;
 
+        // the tick array of the filter the pivot belongs to, fetched on use as the pool may grow meanwhile
+        pivot_ticks_fn pivot_ticks_{ nullptr };
+        tick_type since_{ 0U };
+        bool marks_changes_{ true };
+
+
+        [[nodiscard]] auto pick_pivot( ) const noexcept -> detail::base_reg_pool_type&
+        {
+            if constexpr ( is_tick_filtered )
+            {
+                return *meta::find_smallest<detail::base_reg_pool_type>( filter_pools_ );
+            }
+            else if constexpr ( not has_optionals )
+            {
+                return *meta::find_smallest<detail::base_reg_pool_type>( pools_ );
+            }
+            else
+            {
+                // optional pools cannot lead, the entities without the component would be skipped
+                detail::base_reg_pool_type* smallest{ nullptr };
+                std::apply(
+                    [&smallest]( auto&... pools )
+                    {
+                        auto const consider = [&smallest]( detail::base_reg_pool_type& pool, bool const required )
+                        {
+                            if ( required && ( smallest == nullptr || pool.size( ) < smallest->size( ) ) ) { smallest = &pool; }
+                        };
+                        ( consider( pools, not detail::view_component_traits<TComponents>::is_optional ), ... );
+                    }, pools_ );
+                return *smallest;
+            }
+        }
+
+
+        template <std::size_t filter_id>
+        auto try_pivot_ticks( ) noexcept -> bool
+        {
+            if ( &smallest_pool_ref_ != &static_cast<detail::base_reg_pool_type&>( std::get<filter_id>( filter_pools_ ) ) )
+            {
+                return false;
+            }
+            pivot_ticks_ = []( basic_view const& self ) noexcept -> std::span<tick_type const>
+            {
+                using filter_type = std::tuple_element_t<filter_id, std::tuple<TFilters...>>;
+                return detail::tick_filter_traits<filter_type>::ticks( std::get<filter_id>( self.filter_pools_ ) );
+            };
+            return true;
+        }
+
+
+        template <detail::tick_filter TFilter>
+        [[nodiscard]] auto passes( entity_type const entity ) const noexcept -> bool
+        {
+            auto const& pool     = std::get<meta::index_of_v<TFilter, TFilters...>>( filter_pools_ );
+            std::size_t const pos = pool.position( entity );
+            return pos != detail::base_reg_pool_type::npos &&
+                   is_newer_tick( detail::tick_filter_traits<TFilter>::ticks( pool )[pos], since_ );
+        }
+
+
+        /**
+         * @return True if @entity has TComponent, always true for optional components
+         */
+        template <typename TComponent>
+        [[nodiscard]] auto contains( entity_type const entity ) const noexcept -> bool
+        {
+            if constexpr ( detail::view_component_traits<std::remove_const_t<TComponent>>::is_optional )
+            {
+                return true;
+            }
+            else
+            {
+                return std::get<meta::index_of_v<TComponent, TComponents...>>( pools_ ).has( entity );
+            }
+        }
+
 
-        template <typename TResult, meta::contains_type<TComponents...>... UComponents>
+        /**
+         * @return True if @entity passes every tick filter and has none of the excluded components
+         */
+        [[nodiscard]] auto passes_filters( [[maybe_unused]] entity_type const entity ) const noexcept -> bool
+        {
+            return ( passes<TFilters>( entity ) && ... ) &&
+                   ( not std::get<meta::index_of_v<TExcluded, TExcluded...>>( excluded_pools_ ).has( entity ) && ... );
+        }
+
+
+        /**
+         * @return True if @entity has every required component and passes every filter
+         */
+        [[nodiscard]] auto accepts( entity_type const entity ) const noexcept -> bool
+        {
+            return ( contains<TComponents>( entity ) && ... ) && passes_filters( entity );
+        }
+
+
+        /**
+         * @return The first pivot position from @pos holding an accepted entity, or the pivot's size
+         */
+        [[nodiscard]] auto next_match( std::size_t pos ) const noexcept -> std::size_t requires is_filtered
+        {
+            std::span<entity_type const> const pivot = smallest_pool_ref_.packed( );
+            if constexpr ( is_tick_filtered )
+            {
+                std::span<tick_type const> const ticks = pivot_ticks_( *this );
+                for ( ; pos < pivot.size( ); ++pos )
+                {
+                    // the pivot's own ticks first, an untouched element costs a single compare
+                    if ( is_newer_tick( ticks[pos], since_ ) && accepts( pivot[pos] ) ) { break; }
+                }
+            }
+            else
+            {
+                while ( pos < pivot.size( ) && not accepts( pivot[pos] ) ) { ++pos; }
+            }
+            return std::min( pos, pivot.size( ) );
+        }
+
+
+        /**
+         * @return The component of @entity, stamped as changed if the access is mutable and TComponent tracks changes.
+         * A pointer for optional components, null if @entity lacks it
+         */
+        template <typename TComponent, bool as_const>
+        [[nodiscard]] auto access( entity_type const entity ) const noexcept
+            -> detail::view_reference_t<std::conditional_t<as_const, TComponent const, TComponent>>
+        {
+            using component_type = detail::view_component_traits<std::remove_const_t<TComponent>>::component_type;
+
+            auto& pool = std::get<meta::index_of_v<TComponent, TComponents...>>( pools_ );
+            if constexpr ( detail::view_component_traits<std::remove_const_t<TComponent>>::is_optional )
+            {
+                if ( not pool.has( entity ) ) { return nullptr; }
+                return &access_component<component_type, as_const>( pool, entity );
+            }
+            else
+            {
+                return access_component<component_type, as_const>( pool, entity );
+            }
+        }
+
+
+        template <typename TComponent, bool as_const, typename TPool>
+        [[nodiscard]] auto access_component( TPool& pool, entity_type const entity ) const noexcept
+            -> std::conditional_t<as_const, TComponent const&, TComponent&>
+        {
+            if constexpr ( not as_const && not std::is_const_v<TComponent> && change_tracked<TComponent> )
+            {
+                if ( marks_changes_ ) { return pool.touch( entity ); }
+            }
+            return pool.unsafe_get( entity );
+        }
+
+
+        template <typename TResult, bool as_const, meta::contains_type<TComponents...>... UComponents>
         [[nodiscard]] auto get_impl( entity_type const entity ) const noexcept -> TResult
         {
             // if the requested components are empty, recurse to get all components
             if constexpr ( sizeof...( UComponents ) == 0U )
             {
-                return get_impl<TResult, TComponents...>( entity );
+                return get_impl<TResult, as_const, TComponents...>( entity );
             }
             else
             {
@@ -513,7 +1016,9 @@ namespace rst::ecs
                     {
                         return std::unexpected{ ecs_error::invalid_entity_id };
                     }
-                    if ( not smallest_pool_ref_.has( entity ) )
+                    // pools compare the full handle, a stale version is reported as not found. The pivot of a
+                    // tick filtered view is not a component pool, the components are checked instead
+                    if ( is_tick_filtered ? not ( contains<UComponents>( entity ) && ... ) : not smallest_pool_ref_.has( entity ) )
                     {
                         return std::unexpected{ ecs_error::entity_not_found };
                     }
@@ -522,19 +1027,17 @@ namespace rst::ecs
                 // return the requested components, wrapped around a std::expected
                 if constexpr ( meta::expected_like<TResult, ecs_error> )
                 {
-                    return TResult{
-                        std::in_place, std::get<meta::index_of_v<UComponents, TComponents...>>( pools_ ).unsafe_get( entity )...
-                    };
+                    return TResult{ std::in_place, access<UComponents, as_const>( entity )... };
                 }
                 else
                 {
-                    return TResult{ std::get<meta::index_of_v<UComponents, TComponents...>>( pools_ ).unsafe_get( entity )... };
+                    return TResult{ access<UComponents, as_const>( entity )... };
                 }
             }
         }
 
 
-        template <bool include_entity, typename TDelegate>
+        template <bool include_entity, bool as_const, typename TDelegate>
         auto each_impl( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
         {
             for ( entity_type entity : *this )
@@ -542,15 +1045,192 @@ namespace rst::ecs
                 // we give for granted this entity is valid, as it comes from the smallest pool iteration
                 if constexpr ( include_entity )
                 {
-                    delegate( entity, std::get<meta::index_of_v<TComponents, TComponents...>>( pools_ ).unsafe_get( entity )... );
+                    delegate( entity, access<TComponents, as_const>( entity )... );
                 }
                 else
                 {
-                    delegate( std::get<meta::index_of_v<TComponents, TComponents...>>( pools_ ).unsafe_get( entity )... );
+                    delegate( access<TComponents, as_const>( entity )... );
+                }
+            }
+        }
+
+
+        template <bool include_entity, bool as_const, typename TDelegate>
+        auto par_each_impl( thread::worker_pool& pool, TDelegate& delegate ) const -> void
+        {
+            std::span<entity_type const> const pivot = smallest_pool_ref_.packed( );
+            std::span<tick_type const> ticks{};
+            if constexpr ( is_tick_filtered ) { ticks = pivot_ticks_( *this ); }
+
+            std::size_t const chunk_count = pool.thread_count( ) * par_chunks_per_thread_;
+            std::size_t chunk_size        = ( pivot.size( ) + chunk_count - 1U ) / chunk_count;
+            chunk_size = ( chunk_size + par_chunk_alignment_ - 1U ) / par_chunk_alignment_ * par_chunk_alignment_;
+
+            pool.parallel_for(
+                pivot.size( ), chunk_size,
+                [this, pivot, ticks, &delegate]( std::size_t const first, std::size_t const last )
+                {
+                    for ( std::size_t pos = first; pos < last; ++pos )
+                    {
+                        if constexpr ( is_tick_filtered )
+                        {
+                            if ( not is_newer_tick( ticks[pos], since_ ) ) { continue; }
+                        }
+
+                        // the pivot holds the entity, the other pools still have to be checked
+                        entity_type const entity = pivot[pos];
+                        if ( not accepts( entity ) )
+                        {
+                            continue;
+                        }
+                        if constexpr ( include_entity )
+                        {
+                            delegate( entity, access<TComponents, as_const>( entity )... );
+                        }
+                        else
+                        {
+                            delegate( access<TComponents, as_const>( entity )... );
+                        }
+                    }
+                } );
+        }
+
+
+        template <bool include_entities, bool as_const, typename TDelegate>
+        auto each_chunk_impl( TDelegate&& delegate ) const noexcept(std::is_nothrow_invocable_v<TDelegate>) -> void
+        {
+            [&]<std::size_t... pool_ids>( std::index_sequence<pool_ids...> )
+            {
+                std::span<entity_type const> const pivot = smallest_pool_ref_.packed( );
+                std::array<std::span<entity_type const>, sizeof...( TComponents )> const packed{
+                    std::get<pool_ids>( pools_ ).packed( )...
+                };
+
+                std::size_t pos{ 0U };
+                while ( pos < pivot.size( ) )
+                {
+                    if constexpr ( is_filtered )
+                    {
+                        if ( not passes_filters( pivot[pos] ) )
+                        {
+                            ++pos;
+                            continue;
+                        }
+                    }
+
+                    // 1. locate the pivot entity in every pool, skip it if one of them lacks it
+                    std::array<std::size_t, sizeof...( TComponents )> const starts{
+                        std::get<pool_ids>( pools_ ).position( pivot[pos] )...
+                    };
+                    if ( std::ranges::find( starts, detail::base_reg_pool_type::npos ) != starts.end( ) )
+                    {
+                        ++pos;
+                        continue;
+                    }
+
+                    // 2. extend the chunk while every pool holds the same entities in the same order
+                    std::size_t const limit = std::min( { chunk_limit<TComponents>( starts[pool_ids] )... } );
+                    std::size_t length{ 1U };
+                    while ( pos + length < pivot.size( ) && length < limit &&
+                            ( not has_stable_pools_ || pivot[pos + length] != detail::base_reg_pool_type::tombstone ) &&
+                            ( ( starts[pool_ids] + length < packed[pool_ids].size( ) &&
+                                packed[pool_ids][starts[pool_ids] + length] == pivot[pos + length] ) && ... ) &&
+                            ( not is_filtered || passes_filters( pivot[pos + length] ) ) )
+                    {
+                        ++length;
+                    }
+
+                    // 3. hand out the chunk straight from the pools' storage, mutable chunks count as changed
+                    if constexpr ( not as_const )
+                    {
+                        ( touch_chunk<TComponents>( starts[pool_ids], length ), ... );
+                    }
+                    if constexpr ( include_entities )
+                    {
+                        delegate(
+                            pivot.subspan( pos, length ),
+                            std::span<std::conditional_t<as_const, TComponents const, TComponents>>{
+                                chunk_of<TComponents>( starts[pool_ids], length )
+                            }... );
+                    }
+                    else
+                    {
+                        delegate(
+                            std::span<std::conditional_t<as_const, TComponents const, TComponents>>{
+                                chunk_of<TComponents>( starts[pool_ids], length )
+                            }... );
+                    }
+                    pos += length;
+                }
+            }( std::index_sequence_for<TComponents...>{ } );
+        }
+
+
+        template <typename TComponent>
+        [[nodiscard]] auto chunk_of( std::size_t const first, std::size_t const count ) const noexcept
+            -> std::span<std::remove_const_t<TComponent>>
+        {
+            auto& pool = std::get<meta::index_of_v<TComponent, TComponents...>>( pools_ );
+            if constexpr ( std::remove_reference_t<decltype( pool )>::is_tag_set )
+            {
+                return pool.tag_span( count );
+            }
+            else if constexpr ( std::remove_reference_t<decltype( pool )>::is_pointer_stable )
+            {
+                return pool.page_data( first, count );
+            }
+            else
+            {
+                return pool.data( ).subspan( first, count );
+            }
+        }
+
+
+        /**
+         * @return The longest chunk TComponent's pool can hand out from packed position @first
+         */
+        template <typename TComponent>
+        [[nodiscard]] auto chunk_limit( std::size_t const first ) const noexcept -> std::size_t
+        {
+            using pool_type = detail::view_pool_type<TComponent>;
+            if constexpr ( pool_type::is_pointer_stable )
+            {
+                return std::min( max_chunk_length_, pool_type::page_end( first ) - first );
+            }
+            else
+            {
+                return max_chunk_length_;
+            }
+        }
+
+
+        template <typename TComponent>
+        auto touch_chunk( std::size_t const first, std::size_t const count ) const noexcept -> void
+        {
+            if constexpr ( not std::is_const_v<TComponent> && change_tracked<TComponent> )
+            {
+                if ( marks_changes_ )
+                {
+                    std::get<meta::index_of_v<TComponent, TComponents...>>( pools_ ).touch_range( first, count );
                 }
             }
         }
     };
+
+
+    /**
+     * @brief A view over the entities that have every component of TArguments and pass every filter in it.
+     *
+     * Components, optional<T>, filters (added<T>, changed<T>) and exclude<T...> can be listed in any order, see
+     * basic_view.
+     *
+     * @tparam TArguments The component types and filters of the view.
+     */
+    template <detail::view_argument... TArguments>
+    using view = basic_view<
+        typename detail::split_view_arguments<meta::type_list<>, meta::type_list<>, meta::type_list<>, TArguments...>::components,
+        typename detail::split_view_arguments<meta::type_list<>, meta::type_list<>, meta::type_list<>, TArguments...>::filters,
+        typename detail::split_view_arguments<meta::type_list<>, meta::type_list<>, meta::type_list<>, TArguments...>::excludes>;
 }
 
 
@@ -0,0 +1,222 @@
+#ifndef RST_ECS_VIEW_FILTER_H
+#define RST_ECS_VIEW_FILTER_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_traits.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/component_traits.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst::ecs
+{
+    /**
+     * @brief View filter matching the entities whose TComponent was added after the view's tick.
+     *
+     * Filters go in the view's template arguments next to the components and only restrict the entities
+     * visited, the delegates receive no argument for them.
+     *
+     * @code
+     * // every sprite created since the system last ran
+     * registry.view<sprite const, added<sprite>>( last_run_tick( ) ).each( ... );
+     * @endcode
+     *
+     * @tparam TComponent A component type tracking changes, see component_traits
+     */
+    template <detail::viewable_ecs_component TComponent> requires change_tracked<TComponent>
+    struct added final { };
+
+
+    /**
+     * @brief View filter matching the entities whose TComponent was added, replaced or accessed mutably through
+     * a view after the view's tick.
+     *
+     * @code
+     * // re-upload only the sprites that moved since the system last ran
+     * registry.view<sprite const, changed<transform>>( last_run_tick( ) ).each( ... );
+     * @endcode
+     *
+     * @tparam TComponent A component type tracking changes, see component_traits
+     */
+    template <detail::viewable_ecs_component TComponent> requires change_tracked<TComponent>
+    struct changed final { };
+
+
+    /**
+     * @brief View filter rejecting the entities that have any of TComponents.
+     *
+     * The excluded pools are resolved when the view is created, so each excluded type costs one sparse lookup per
+     * visited entity.
+     *
+     * @code
+     * registry.view<transform, velocity, exclude<frozen, dead>>( ).each( ... );
+     * @endcode
+     *
+     * @tparam TComponents The component types the entities must not have
+     */
+    template <detail::viewable_ecs_component... TComponents> requires ( sizeof...( TComponents ) > 0U )
+    struct exclude final { };
+
+
+    /**
+     * @brief View argument handing out TComponent when the entity has it, without requiring it.
+     *
+     * Delegates receive a pointer in its place, null for the entities without a TComponent.
+     *
+     * @code
+     * registry.view<transform, optional<velocity const>>( ).each( []( transform& tf, velocity const* vel ) {
+     *     if ( vel != nullptr ) { ... }
+     * } );
+     * @endcode
+     *
+     * @tparam TComponent The component type, const for read-only access
+     */
+    template <detail::viewable_ecs_component TComponent>
+    struct optional final { };
+
+
+    namespace detail
+    {
+        // +--------------------------------+
+        // | TICK FILTERS                   |
+        // +--------------------------------+
+        template <typename TFilter>
+        struct tick_filter_traits
+        {
+            static constexpr bool is_filter{ false };
+        };
+
+
+        template <typename TComponent>
+        struct tick_filter_traits<added<TComponent>>
+        {
+            static constexpr bool is_filter{ true };
+
+            using component_type = std::remove_const_t<TComponent>;
+
+            [[nodiscard]] static auto ticks( reg_pool_type<component_type> const& pool ) noexcept -> std::span<tick_type const>
+            {
+                return pool.added_ticks( );
+            }
+        };
+
+
+        template <typename TComponent>
+        struct tick_filter_traits<changed<TComponent>>
+        {
+            static constexpr bool is_filter{ true };
+
+            using component_type = std::remove_const_t<TComponent>;
+
+            [[nodiscard]] static auto ticks( reg_pool_type<component_type> const& pool ) noexcept -> std::span<tick_type const>
+            {
+                return pool.changed_ticks( );
+            }
+        };
+
+
+        template <typename T>
+        concept tick_filter = tick_filter_traits<T>::is_filter;
+
+
+        template <tick_filter TFilter>
+        using filter_pool_type = reg_pool_type<typename tick_filter_traits<TFilter>::component_type>;
+
+
+        // +--------------------------------+
+        // | VIEW COMPONENTS                |
+        // +--------------------------------+
+        /**
+         * How a view hands out each of its components: a reference to a required component, a pointer to an
+         * optional one.
+         */
+        template <typename TComponent>
+        struct view_component_traits
+        {
+            using component_type = TComponent;
+
+            static constexpr bool is_optional{ false };
+
+            template <bool as_const>
+            using reference_type = std::conditional_t<as_const, TComponent const&, TComponent&>;
+        };
+
+
+        template <typename TComponent>
+        struct view_component_traits<optional<TComponent>>
+        {
+            using component_type = TComponent;
+
+            static constexpr bool is_optional{ true };
+
+            template <bool as_const>
+            using reference_type = std::conditional_t<as_const, TComponent const*, TComponent*>;
+        };
+
+
+        template <typename T>
+        concept view_component = viewable_ecs_component<T> || view_component_traits<T>::is_optional;
+
+
+        /**
+         * What a view hands out for TComponent, a const-qualified TComponent asks for read-only access.
+         */
+        template <typename TComponent>
+        using view_reference_t =
+        view_component_traits<std::remove_const_t<TComponent>>::template reference_type<std::is_const_v<TComponent>>;
+
+
+        template <typename TComponent>
+        using view_pool_type = reg_pool_type<typename view_component_traits<TComponent>::component_type>;
+
+
+        // +--------------------------------+
+        // | VIEW ARGUMENTS                 |
+        // +--------------------------------+
+        template <typename T>
+        struct is_exclude : std::false_type { };
+
+        template <typename... TComponents>
+        struct is_exclude<exclude<TComponents...>> : std::true_type { };
+
+
+        template <typename T>
+        concept view_argument = view_component<T> || tick_filter<T> || is_exclude<T>::value;
+
+
+        /**
+         * Splits the template arguments of a view into its components (optional ones included), its tick filters
+         * and its excluded components, keeping their order.
+         */
+        template <typename TComponentList, typename TFilterList, typename TExcludeList, typename... TArguments>
+        struct split_view_arguments
+        {
+            using components = TComponentList;
+            using filters    = TFilterList;
+            using excludes   = TExcludeList;
+        };
+
+
+        template <typename... TComponents, typename... TFilters, typename... TExcluded, typename TFirst, typename... TRest>
+        struct split_view_arguments<
+                meta::type_list<TComponents...>, meta::type_list<TFilters...>, meta::type_list<TExcluded...>, TFirst, TRest...>
+            : std::conditional_t<
+                tick_filter<TFirst>,
+                split_view_arguments<
+                    meta::type_list<TComponents...>, meta::type_list<TFilters..., TFirst>, meta::type_list<TExcluded...>, TRest...>,
+                split_view_arguments<
+                    meta::type_list<TComponents..., TFirst>, meta::type_list<TFilters...>, meta::type_list<TExcluded...>, TRest...>> { };
+
+
+        template <typename... TComponents, typename... TFilters, typename... TExcluded, typename... TFirst, typename... TRest>
+        struct split_view_arguments<
+                meta::type_list<TComponents...>, meta::type_list<TFilters...>, meta::type_list<TExcluded...>,
+                exclude<TFirst...>, TRest...>
+            : split_view_arguments<
+                meta::type_list<TComponents...>, meta::type_list<TFilters...>, meta::type_list<TExcluded..., TFirst...>, TRest...> { };
+    }
+}
+
+
+#endif //!RST_ECS_VIEW_FILTER_H
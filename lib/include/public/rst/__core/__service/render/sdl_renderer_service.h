@@ -54,7 +54,8 @@ namespace rst::service
         glm::vec4 clear_color_{};
 
         std::atomic<int> z_index_{ 0 };
-        std::multiset<internal::request, internal::request_comparator> render_queue_{};
+        // kept in z order on dispatch, requests mostly arrive in order already
+        std::vector<internal::request> render_queue_{};
 
         [[nodiscard]] auto make_pelt( earmark mark, std::filesystem::path const& file_path ) -> std::unique_ptr<pelt> override;
         auto render_dispatch( ) noexcept -> void override;
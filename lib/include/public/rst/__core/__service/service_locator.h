@@ -4,7 +4,10 @@
 #include <rst/pch.h>
 
 #include <rst/diagnostic.h>
+#include <rst/data_type/memory_resource.h>
+#include <rst/data_type/worker_pool.h>
 #include <rst/__core/service.h>
+#include <rst/__core/__system/frame_profiler.h>
 
 
 namespace rst
@@ -60,9 +63,130 @@ namespace rst
             return renderer_service_ptr_ != nullptr;
         }
 
+
+        /**
+         * @brief Creates the engine's worker pool, shared by parallel views and systems. Replaces any previous one.
+         * @param thread_count Total number of threads running tasks, the waiting thread included
+         */
+        auto register_worker_pool( std::size_t const thread_count = thread::worker_pool::default_thread_count( ) )
+            -> thread::worker_pool&
+        {
+            worker_pool_ptr_ = std::make_unique<thread::worker_pool>( thread_count );
+
+            // the scratch arenas follow the threads of the pool
+            if ( is_frame_scratch_registered( ) )
+            {
+                register_frame_scratch( frame_scratch_.front( )->initial_capacity( ) );
+            }
+            return *worker_pool_ptr_;
+        }
+
+
+        [[nodiscard]] auto worker_pool( ) const noexcept -> thread::worker_pool&
+        {
+            ensure( is_worker_pool_registered( ), "instance not registered!" );
+            return *worker_pool_ptr_;
+        }
+
+
+        [[nodiscard]] auto is_worker_pool_registered( ) const noexcept -> bool
+        {
+            return worker_pool_ptr_ != nullptr;
+        }
+
+        /**
+         * @brief Creates the engine's frame scratch arenas, one per thread of the worker pool, reset at the end of
+         * every frame. Replaces any previous ones.
+         * @param initial_bytes Bytes reserved up front by each arena, frames needing more fall back to the default
+         * resource
+         * @return The arena of the calling thread, the one frame_scratch( ) returns outside of the worker pool
+         */
+        auto register_frame_scratch( std::size_t const initial_bytes = default_frame_scratch_bytes ) -> memory::monotonic_arena&
+        {
+            std::size_t const thread_count = is_worker_pool_registered( ) ? worker_pool_ptr_->thread_count( ) : 1U;
+
+            frame_scratch_.clear( );
+            frame_scratch_.reserve( thread_count );
+            for ( std::size_t i = 0U; i < thread_count; ++i )
+            {
+                frame_scratch_.push_back( std::make_unique<memory::monotonic_arena>( initial_bytes ) );
+            }
+            frame_scratch_thread_ = std::this_thread::get_id( );
+            return *frame_scratch_.front( );
+        }
+
+
+        /**
+         * @return The calling thread's frame scratch arena, for temporaries that do not outlive the frame (e.g. a
+         * std::pmr::vector built by a system, or by a task of the worker pool).
+         * @note Each worker of the pool has an arena of its own, the thread that registered the arenas has the
+         * first one. Other threads have none and must not call it.
+         */
+        [[nodiscard]] auto frame_scratch( ) const noexcept -> memory::monotonic_arena&
+        {
+            ensure( is_frame_scratch_registered( ), "instance not registered!" );
+
+            std::size_t const index = is_worker_pool_registered( ) ? worker_pool_ptr_->thread_index( ) : 0U;
+            ensure( index != 0U || std::this_thread::get_id( ) == frame_scratch_thread_,
+                    "frame scratch used outside of the main thread and the worker pool!" );
+            return *frame_scratch_[index];
+        }
+
+
+        /**
+         * @brief Drops what the frame allocated from every scratch arena.
+         * @note Call it from the main thread, once no task of the worker pool is running.
+         */
+        auto reset_frame_scratch( ) noexcept -> void
+        {
+            for ( auto const& arena : frame_scratch_ )
+            {
+                arena->reset( );
+            }
+        }
+
+
+        [[nodiscard]] auto is_frame_scratch_registered( ) const noexcept -> bool
+        {
+            return not frame_scratch_.empty( );
+        }
+
+#ifdef RST_ENABLE_PROFILING
+        /**
+         * @brief Creates the engine's profiler, recording scheduler hooks, systems and frames. Replaces any previous one.
+         * @param window Number of most recent calls the statistics cover, per scope
+         */
+        auto register_profiler( std::size_t const window = frame_profiler::default_window ) -> frame_profiler&
+        {
+            profiler_ptr_ = std::make_unique<frame_profiler>( window );
+            return *profiler_ptr_;
+        }
+
+
+        [[nodiscard]] auto profiler( ) const noexcept -> frame_profiler&
+        {
+            ensure( is_profiler_registered( ), "instance not registered!" );
+            return *profiler_ptr_;
+        }
+
+
+        [[nodiscard]] auto is_profiler_registered( ) const noexcept -> bool
+        {
+            return profiler_ptr_ != nullptr;
+        }
+#endif
+
     private:
+        static constexpr std::size_t default_frame_scratch_bytes{ 1U << 20U };
+
         std::unique_ptr<rst::sound_service> sound_service_ptr_{ nullptr };
         std::unique_ptr<rst::renderer_service> renderer_service_ptr_{ nullptr };
+        std::unique_ptr<thread::worker_pool> worker_pool_ptr_{ nullptr };
+        std::vector<std::unique_ptr<memory::monotonic_arena>> frame_scratch_{}; // indexed by worker_pool::thread_index
+        std::thread::id frame_scratch_thread_{};
+#ifdef RST_ENABLE_PROFILING
+        std::unique_ptr<frame_profiler> profiler_ptr_{ nullptr };
+#endif
     };
 }
 
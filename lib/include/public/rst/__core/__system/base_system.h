@@ -3,12 +3,19 @@
 
 #include <rst/pch.h>
 
+#include <rst/meta/type_traits.h>
+#include <rst/__core/__ecs/command_buffer.h>
 #include <rst/__core/__ecs/registry.h>
 #include <rst/__core/__service/service_locator.h>
+#include <rst/__core/__system/system_access.h>
 
 
 namespace rst
 {
+    template <typename THook> requires meta::enum_traits<THook>::is_sequential
+    class system_scheduler;
+
+
     /**
      * @brief Abstract base class for all systems in the ECS architecture.
      *
@@ -19,6 +26,8 @@ namespace rst
      * Features:
      * - Pure virtual tick() method for system-specific logic implementation
      * - Named systems for debugging and profiling identification
+     * - Optional read/write component declarations for parallel scheduling
+     * - The change tick of the previous run, for incremental systems filtering on added<T> and changed<T>
      * - Non-copyable and non-movable for unique system ownership
      * - Direct access to ECS registry and service locator
      *
@@ -49,15 +58,22 @@ namespace rst
      */
     class base_system
     {
+        template <typename THook> requires meta::enum_traits<THook>::is_sequential
+        friend class system_scheduler;
+
     public:
         /**
          * @brief Constructs system with a debug name.
          *
          * @param name Human-readable name for debugging and profiling
+         * @param access Components the system reads and writes, exclusive by default
          *
          * @note Name should be descriptive and unique for identification
+         * @note Declaring the access lets the scheduler run the system alongside non-conflicting ones
          */
-        explicit base_system( char const* name ) noexcept : name_{ name } { }
+        explicit base_system( char const* name, system_access access = system_access::exclusive( ) ) noexcept
+            : name_{ name }
+            , access_{ std::move( access ) } { }
 
         /**
          * @brief Virtual destructor for proper cleanup of derived systems.
@@ -79,6 +95,40 @@ namespace rst
          */
         [[nodiscard]] auto name( ) const noexcept -> std::string_view const& { return name_; }
 
+        /**
+         * @brief Gets the system's declared component access.
+         *
+         * @return system_access const& The descriptor the scheduler builds its dependency graph from
+         *
+         * @complexity O(1)
+         */
+        [[nodiscard]] auto access( ) const noexcept -> system_access const& { return access_; }
+
+        /**
+         * @brief Gets the buffer for structural changes the system defers while iterating.
+         *
+         * @return ecs::command_buffer& The system's own buffer
+         *
+         * @complexity O(1)
+         * @note The scheduler plays it back once every system of the hook has ticked
+         */
+        [[nodiscard]] auto commands( ) noexcept -> ecs::command_buffer& { return commands_; }
+
+        /**
+         * @brief Gets the registry tick the system's previous run started at.
+         *
+         * @return ecs::tick_type The tick to pass to registry::view for added<T> and changed<T> filters, 0 before
+         * the first run so that everything counts as new
+         *
+         * @complexity O(1)
+         * @note Set by the system scheduler, changes the system itself made in its previous run are not newer
+         *
+         * @code
+         * auto sprites = registry.view<sprite const, changed<transform>>(last_run_tick());
+         * @endcode
+         */
+        [[nodiscard]] auto last_run_tick( ) const noexcept -> ecs::tick_type { return last_run_tick_; }
+
         /**
          * @brief Executes system logic for one frame/update cycle.
          *
@@ -99,7 +149,10 @@ namespace rst
         virtual auto tick( ecs::registry& registry, service_locator const& locator ) noexcept -> void = 0;
 
     private:
-        std::string_view const name_; ///< Debug name for system identification
+        std::string_view const name_;   ///< Debug name for system identification
+        system_access const access_;     ///< Declared component access, for parallel scheduling
+        ecs::command_buffer commands_{}; ///< Deferred structural changes, played back at the end of the hook
+        ecs::tick_type last_run_tick_{ 0U }; ///< Registry tick the previous run started at
     };
 }
 
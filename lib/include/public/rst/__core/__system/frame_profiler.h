@@ -0,0 +1,211 @@
+#ifndef RST_FRAME_PROFILER_H
+#define RST_FRAME_PROFILER_H
+
+#include <rst/pch.h>
+
+
+#ifdef RST_ENABLE_PROFILING
+
+namespace rst
+{
+    /**
+     * @brief What a profiled scope measures, used to group scopes in queries and traces.
+     */
+    enum class profile_category : uint8_t
+    {
+        frame,  ///< A whole engine frame
+        hook,   ///< Every system of a scheduler hook, command playback included
+        system, ///< A single system tick
+        user    ///< Scopes opened by game code
+    };
+
+
+    /**
+     * @brief Timings of a profiled scope, over the profiler's rolling window.
+     */
+    struct profile_stats final
+    {
+        profile_category category;
+        std::size_t calls;             ///< Every call since the last clear or window change
+        std::chrono::nanoseconds last; ///< Most recent call
+        std::chrono::nanoseconds min;
+        std::chrono::nanoseconds avg;
+        std::chrono::nanoseconds p99;
+    };
+
+
+    /**
+     * @brief Collects wall times of named scopes: rolling statistics per name and a bounded event trace.
+     *
+     * Every call of a scope is recorded twice: in the scope's ring of the last `window` durations, which
+     * min/avg/p99 are computed from, and in the trace, a ring of the last `trace_capacity` events with their
+     * start time and thread, exported in the Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+     *
+     * The system_scheduler records every hook and system tick, hare records every frame, when a profiler is
+     * registered in the service locator. Game code can open its own scopes with profile_scope or
+     * RST_PROFILE_SCOPE.
+     *
+     * @code
+     * auto const stats = locator.profiler( ).stats( "movement" );
+     * if ( stats && stats->p99 > 2ms ) { ... }
+     *
+     * locator.profiler( ).write_chrome_trace( "frame_trace.json" );
+     * @endcode
+     *
+     * @note Thread safe, recording takes a lock. Only exists when RST_ENABLE_PROFILING is defined, the engine
+     * compiles every call site out otherwise.
+     */
+    class frame_profiler final
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        static constexpr std::size_t default_window{ 120U };
+        static constexpr std::size_t default_trace_capacity{ 1U << 16U };
+
+        /**
+         * @param window Number of most recent calls the statistics cover, per scope
+         * @param trace_capacity Number of most recent events kept for the trace
+         */
+        explicit frame_profiler( std::size_t window = default_window, std::size_t trace_capacity = default_trace_capacity );
+        ~frame_profiler( ) noexcept = default;
+
+        frame_profiler( frame_profiler const& )                        = delete;
+        frame_profiler( frame_profiler&& ) noexcept                    = delete;
+        auto operator=( frame_profiler const& ) -> frame_profiler&     = delete;
+        auto operator=( frame_profiler&& ) noexcept -> frame_profiler& = delete;
+
+        /**
+         * @brief Records one call of a scope.
+         * @complexity O(log s) where s is the number of distinct scope names
+         * @param name Name of the scope, copied on its first call
+         * @param category What the scope measures
+         * @param begin When the call started
+         * @param end When the call returned
+         */
+        auto record( std::string_view name, profile_category category, clock_type::time_point begin, clock_type::time_point end ) -> void;
+
+        /**
+         * @complexity O(w log w) where w is the window size
+         * @param name Name of the scope
+         * @return The statistics of the scope, or std::nullopt if it never ran
+         */
+        [[nodiscard]] auto stats( std::string_view name ) const -> std::optional<profile_stats>;
+
+        /**
+         * @complexity O(s w log w) where s is the number of distinct scopes and w the window size
+         * @return The statistics of every scope that ran, by name
+         */
+        [[nodiscard]] auto all_stats( ) const -> std::vector<std::pair<std::string, profile_stats>>;
+
+        /**
+         * @brief Changes the number of calls the statistics cover, dropping the samples collected so far.
+         * @param window Number of most recent calls per scope, at least 1
+         */
+        auto set_window( std::size_t window ) -> void;
+
+        /**
+         * @return Number of most recent calls the statistics cover
+         */
+        [[nodiscard]] auto window( ) const -> std::size_t;
+
+        /**
+         * @brief Writes the trace as Chrome trace event JSON, openable in chrome://tracing or ui.perfetto.dev.
+         * @param path The file to create or overwrite
+         * @return True on success, false (with an alert) if the file could not be written
+         */
+        auto write_chrome_trace( std::filesystem::path const& path ) const -> bool;
+
+        /**
+         * @brief Drops every statistic and trace event.
+         */
+        auto clear( ) -> void;
+
+    private:
+        struct scope_samples final
+        {
+            profile_category category;
+            std::vector<std::chrono::nanoseconds> ring{};
+            std::size_t calls{ 0U };
+        };
+
+
+        struct trace_event final
+        {
+            std::string const* name_ptr; // key of scopes_, map nodes are stable
+            profile_category category;
+            uint32_t thread;
+            clock_type::time_point begin;
+            std::chrono::nanoseconds duration;
+        };
+
+
+        mutable std::mutex mutex_{};
+
+        std::map<std::string, scope_samples, std::less<>> scopes_{};
+        std::size_t window_;
+
+        std::vector<trace_event> trace_{};
+        std::size_t trace_capacity_;
+        std::size_t trace_next_{ 0U };
+        clock_type::time_point const epoch_{ clock_type::now( ) };
+
+
+        [[nodiscard]] static auto compute_stats( scope_samples const& samples ) -> profile_stats;
+    };
+
+
+    /**
+     * @brief Records the lifetime of the scope it is declared in.
+     */
+    class profile_scope final
+    {
+    public:
+        profile_scope( frame_profiler& profiler, std::string_view name, profile_category category = profile_category::user ) noexcept
+            : profiler_ref_{ profiler }
+            , name_{ name }
+            , category_{ category } { }
+
+
+        ~profile_scope( ) noexcept
+        {
+            // recording may allocate: a sample lost to a failed allocation beats terminating the profiled code
+            try
+            {
+                profiler_ref_.record( name_, category_, begin_, frame_profiler::clock_type::now( ) );
+            }
+            catch ( ... ) { }
+        }
+
+
+        profile_scope( profile_scope const& )                        = delete;
+        profile_scope( profile_scope&& ) noexcept                    = delete;
+        auto operator=( profile_scope const& ) -> profile_scope&     = delete;
+        auto operator=( profile_scope&& ) noexcept -> profile_scope& = delete;
+
+    private:
+        frame_profiler& profiler_ref_;
+        std::string_view const name_;
+        profile_category const category_;
+        frame_profiler::clock_type::time_point const begin_{ frame_profiler::clock_type::now( ) };
+    };
+}
+
+
+#define RST_PROFILE_CONCAT_IMPL( lhs, rhs ) lhs##rhs
+#define RST_PROFILE_CONCAT( lhs, rhs ) RST_PROFILE_CONCAT_IMPL( lhs, rhs )
+
+/**
+ * Profiles the enclosing scope under @name in @profiler. Expands to nothing without RST_ENABLE_PROFILING.
+ */
+#define RST_PROFILE_SCOPE( profiler, name ) \
+    ::rst::profile_scope const RST_PROFILE_CONCAT( rst_profile_scope_, __LINE__ ){ ( profiler ), ( name ) }
+
+#else
+
+#define RST_PROFILE_SCOPE( profiler, name ) static_cast<void>( 0 )
+
+#endif //RST_ENABLE_PROFILING
+
+
+#endif //!RST_FRAME_PROFILER_H
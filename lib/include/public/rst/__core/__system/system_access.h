@@ -0,0 +1,197 @@
+#ifndef RST_SYSTEM_ACCESS_H
+#define RST_SYSTEM_ACCESS_H
+
+#include <rst/pch.h>
+
+#include <rst/meta/type_index.h>
+#include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/registry.h>
+#include <rst/__core/__ecs/registry_pool.h>
+
+
+namespace rst
+{
+    /**
+     * @brief Declares the components a system only reads.
+     * @tparam TComponents The component types read, cv-qualifiers are ignored
+     */
+    template <ecs::detail::viewable_ecs_component... TComponents>
+    struct reads final { };
+
+
+    /**
+     * @brief Declares the components a system writes (and may read).
+     * @tparam TComponents The component types written
+     */
+    template <ecs::detail::ecs_component... TComponents>
+    struct writes final { };
+
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_access_declaration : std::false_type { };
+
+        template <typename... TComponents>
+        struct is_access_declaration<reads<TComponents...>> : std::true_type { };
+
+        template <typename... TComponents>
+        struct is_access_declaration<writes<TComponents...>> : std::true_type { };
+
+        template <typename T>
+        concept access_declaration = is_access_declaration<T>::value;
+    }
+
+
+    /**
+     * @brief Describes which components a system reads and writes, so the scheduler can run it concurrently with
+     * the systems it does not conflict with.
+     *
+     * Two systems conflict if either of them writes a component the other reads or writes, or if either of them
+     * is exclusive. An exclusive system conflicts with everything: that is the default, so systems that never
+     * declared their access keep running in registration order, on the thread that signals their hook (the main
+     * thread, where SDL calls belong).
+     *
+     * @code
+     * class movement_system final : public base_system
+     * {
+     * public:
+     *     movement_system()
+     *         : base_system{ "movement", system_access::of<reads<velocity>, writes<transform>>() } {}
+     * };
+     * @endcode
+     *
+     * @note A system with declared access may only touch the registry through the declared components. Creating
+     * or destroying entities, or adding and removing components, must go through its command buffer.
+     */
+    class system_access final
+    {
+    public:
+        /**
+         * @return A descriptor conflicting with every other system.
+         */
+        [[nodiscard]] static auto exclusive( ) noexcept -> system_access
+        {
+            return system_access{};
+        }
+
+
+        /**
+         * @brief Builds a descriptor from reads<...> and writes<...> declarations, in any order and number.
+         *
+         * @tparam TDeclarations reads<...> and writes<...> types
+         * @return The descriptor. A component both read and written counts as written.
+         */
+        template <detail::access_declaration... TDeclarations>
+        [[nodiscard]] static auto of( ) -> system_access
+        {
+            system_access access{};
+            access.exclusive_ = false;
+            access.prepare_   = &prepare_impl<TDeclarations...>;
+            ( access.declare( static_cast<TDeclarations*>( nullptr ) ), ... );
+
+            std::ranges::sort( access.writes_ );
+            access.writes_.erase( std::ranges::unique( access.writes_ ).begin( ), access.writes_.end( ) );
+            std::ranges::sort( access.reads_ );
+            access.reads_.erase( std::ranges::unique( access.reads_ ).begin( ), access.reads_.end( ) );
+            std::erase_if( access.reads_, [&access]( auto const id ) { return access.is_written( id ); } );
+            return access;
+        }
+
+
+        /**
+         * @return True if the system may run concurrently with no other system.
+         */
+        [[nodiscard]] auto is_exclusive( ) const noexcept -> bool { return exclusive_; }
+
+
+        /**
+         * @complexity O(r + w) over both descriptors
+         * @param other The descriptor to check against.
+         * @return True if the two systems cannot run concurrently.
+         */
+        [[nodiscard]] auto conflicts_with( system_access const& other ) const noexcept -> bool
+        {
+            if ( exclusive_ || other.exclusive_ ) { return true; }
+
+            auto const intersects = []( auto const& lhs, auto const& rhs )
+            {
+                auto lhs_it = lhs.begin( );
+                auto rhs_it = rhs.begin( );
+                while ( lhs_it != lhs.end( ) && rhs_it != rhs.end( ) )
+                {
+                    if ( *lhs_it == *rhs_it ) { return true; }
+                    *lhs_it < *rhs_it ? ++lhs_it : ++rhs_it;
+                }
+                return false;
+            };
+            return intersects( writes_, other.writes_ ) || intersects( writes_, other.reads_ ) ||
+                   intersects( reads_, other.writes_ );
+        }
+
+
+        /**
+         * @brief Creates the pools of every declared component, so that concurrent systems never grow the
+         * registry's pool table.
+         */
+        auto prepare( ecs::registry& registry ) const -> void
+        {
+            if ( prepare_ != nullptr ) { prepare_( registry ); }
+        }
+
+    private:
+        using prepare_fn = auto ( * )( ecs::registry& ) -> void;
+
+        std::vector<meta::sequential_index_type> reads_{};  // sorted, without the written ones
+        std::vector<meta::sequential_index_type> writes_{}; // sorted
+        bool exclusive_{ true };
+        prepare_fn prepare_{ nullptr };
+
+
+        system_access( ) noexcept = default;
+
+
+        [[nodiscard]] auto is_written( meta::sequential_index_type const id ) const noexcept -> bool
+        {
+            return std::ranges::binary_search( writes_, id );
+        }
+
+
+        template <typename... TComponents>
+        auto declare( reads<TComponents...> const* ) -> void
+        {
+            ( reads_.push_back( ecs::detail::component_sequence::index_of<TComponents>( ) ), ... );
+        }
+
+
+        template <typename... TComponents>
+        auto declare( writes<TComponents...> const* ) -> void
+        {
+            ( writes_.push_back( ecs::detail::component_sequence::index_of<TComponents>( ) ), ... );
+        }
+
+
+        template <typename... TComponents>
+        static auto prepare_declaration( ecs::registry& registry, reads<TComponents...> const* ) -> void
+        {
+            registry.prepare<TComponents...>( );
+        }
+
+
+        template <typename... TComponents>
+        static auto prepare_declaration( ecs::registry& registry, writes<TComponents...> const* ) -> void
+        {
+            registry.prepare<TComponents...>( );
+        }
+
+
+        template <typename... TDeclarations>
+        static auto prepare_impl( ecs::registry& registry ) -> void
+        {
+            ( prepare_declaration( registry, static_cast<TDeclarations*>( nullptr ) ), ... );
+        }
+    };
+}
+
+
+#endif //!RST_SYSTEM_ACCESS_H
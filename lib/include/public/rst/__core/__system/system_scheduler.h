@@ -4,13 +4,25 @@
 #include <rst/pch.h>
 
 #include <rst/data_type/unique_ref.h>
+#include <rst/data_type/worker_pool.h>
 #include <rst/meta/type_traits.h>
 #include <rst/__core/ecs.h>
 #include <rst/__core/__system/base_system.h>
+#include <rst/__core/__system/frame_profiler.h>
 
 
 namespace rst
 {
+    /**
+     * @brief How a system_scheduler runs the systems of a hook.
+     */
+    enum class execution_mode : uint8_t
+    {
+        parallel, ///< Non-conflicting systems run concurrently on the service locator's worker pool
+        serial    ///< Every system runs on the calling thread in registration order, deterministic
+    };
+
+
     /**
      * @brief Manages and schedules execution of ECS systems across timing phases.
      *
@@ -31,9 +43,15 @@ namespace rst
      * Design Philosophy:
      * - Systems are grouped by logical execution phases (e.g., physics, render)
      * - Each timing phase can contain multiple systems
-     * - Systems within a phase execute in registration order
+     * - Systems within a phase keep registration order where their declared accesses conflict,
+     *   the others run concurrently on the worker pool (see system_access)
+     * - Exclusive systems (no declared access, e.g. the renderer) always run on the thread signaling the hook
+     * - A serial execution mode runs everything in registration order, for debugging
+     * - With RST_ENABLE_PROFILING, hooks and systems are timed into the service locator's profiler
      * - Scheduler manages system ownership via unique_ref smart pointers
      * - Registry and service locator are provided to all systems
+     * - Structural changes deferred by systems are applied at the end of their phase
+     * - The registry's change tick advances around every system run (see base_system::last_run_tick)
      *
      * Usage:
      * @code
@@ -89,9 +107,10 @@ namespace rst
          * @param hook Timing phase when system should execute
          * @param args Constructor arguments forwarded to system constructor
          *
-         * @complexity O(1) amortized (vector insertion)
+         * @complexity O(n), where n is systems already in the hook (conflict checks against each of them)
          * @note System is constructed in-place with perfect forwarding
-         * @note Systems within same hook execute in registration order
+         * @note The pools of the declared components are created here, never while the hook runs
+         * @note Systems within same hook execute in registration order where their accesses conflict
          *
          * Example:
          * @code
@@ -102,7 +121,48 @@ namespace rst
         template <std::derived_from<base_system> T, typename... TArgs> requires std::constructible_from<T, TArgs...>
         auto register_system( THook const hook, TArgs&&... args ) noexcept -> void
         {
-            systems_[std::to_underlying( hook )].emplace_back( ref::make_unique<T>( std::forward<TArgs>( args )... ) );
+            auto& systems = systems_[std::to_underlying( hook )];
+            auto& graph   = graphs_[std::to_underlying( hook )];
+
+            base_system const& system = systems.emplace_back( ref::make_unique<T>( std::forward<TArgs>( args )... ) ).value( );
+            system.access( ).prepare( registry_ref_ );
+
+            // every earlier system the new one conflicts with has to finish before it starts
+            std::size_t const node = systems.size( ) - 1U;
+            graph.successors.emplace_back( );
+            graph.dependency_counts.emplace_back( 0U );
+            for ( std::size_t prior = 0U; prior < node; ++prior )
+            {
+                if ( systems[prior]->access( ).conflicts_with( system.access( ) ) )
+                {
+                    graph.successors[prior].push_back( node );
+                    ++graph.dependency_counts[node];
+                }
+            }
+            graph.pending = std::make_unique<std::atomic<std::size_t>[]>( systems.size( ) );
+        }
+
+
+        /**
+         * @brief Selects how hooks run their systems.
+         *
+         * @param mode parallel (default) or serial
+         *
+         * @complexity O(1)
+         * @note Parallel mode falls back to serial while no worker pool is registered in the service locator
+         */
+        auto set_execution_mode( rst::execution_mode const mode ) noexcept -> void
+        {
+            execution_mode_ = mode;
+        }
+
+
+        /**
+         * @return The current execution mode
+         */
+        [[nodiscard]] auto execution_mode( ) const noexcept -> rst::execution_mode
+        {
+            return execution_mode_;
         }
 
 
@@ -112,27 +172,168 @@ namespace rst
          * @param hook Timing phase to execute
          *
          * @complexity O(n * s), where n is systems in phase, s is system complexity
-         * @note Systems execute in registration order within the phase
+         * @note Conflicting systems execute in registration order, the others concurrently
+         * @note Exclusive systems execute on the calling thread, only declared-access systems go to the pool
          * @note Each system receives registry and service locator references
          *
          * Execution Flow:
          * 1. Lookup systems vector for the specified hook
-         * 2. Iterate through systems in registration order
+         * 2. Start every system with no conflicting predecessor (all of them, in order, in serial mode)
          * 3. Call tick() on each system with registry and service locator
-         * 4. Continue until all systems in phase complete
+         * 4. Start each successor once all the systems it conflicts with have finished
+         * 5. Sync point: play back each system's command buffer, in registration order
          */
         auto signal_hook( THook const hook ) noexcept -> void
         {
-            for ( auto& system : systems_[std::to_underlying( hook )] )
+#ifdef RST_ENABLE_PROFILING
+            std::optional<profile_scope> hook_scope{};
+            if ( service_locator_ref_.is_profiler_registered( ) )
             {
-                system->tick( registry_ref_, service_locator_ref_ );
+                hook_scope.emplace( service_locator_ref_.profiler( ), hook_name( hook ), profile_category::hook );
+            }
+#endif
+
+            auto& systems = systems_[std::to_underlying( hook )];
+            if ( execution_mode_ == rst::execution_mode::parallel && systems.size( ) > 1U &&
+                 service_locator_ref_.is_worker_pool_registered( ) &&
+                 service_locator_ref_.worker_pool( ).thread_count( ) > 1U )
+            {
+                run_parallel( systems, graphs_[std::to_underlying( hook )], service_locator_ref_.worker_pool( ) );
+            }
+            else
+            {
+                for ( auto& system : systems )
+                {
+                    tick_system( *system );
+                }
+            }
+
+            for ( auto& system : systems )
+            {
+                if ( not system->commands( ).empty( ) ) { system->commands( ).playback( registry_ref_ ); }
             }
         }
 
     private:
+        /**
+         * Conflict edges between the systems of a hook, always from an earlier to a later registration.
+         */
+        struct hook_graph final
+        {
+            std::vector<std::vector<std::size_t>> successors{};
+            std::vector<std::size_t> dependency_counts{};
+            std::unique_ptr<std::atomic<std::size_t>[]> pending{};
+        };
+
+
         ecs::registry& registry_ref_;
         service_locator const& service_locator_ref_;
         std::array<std::vector<unique_ref<base_system>>, meta::enum_traits<THook>::count> systems_{};
+        std::array<hook_graph, meta::enum_traits<THook>::count> graphs_{};
+        rst::execution_mode execution_mode_{ rst::execution_mode::parallel };
+
+
+        auto tick_system( base_system& system ) noexcept -> void
+        {
+            // the system stamps its writes with a tick of its own, so that its next run does not see them as new,
+            // and anything written once it returned is newer than that tick. A concurrent system advancing the
+            // tick meanwhile makes some of those writes show up again, never hides the writes of another system
+            ecs::tick_type const run_tick = registry_ref_.advance_tick( );
+            {
+#ifdef RST_ENABLE_PROFILING
+                std::optional<profile_scope> scope{};
+                if ( service_locator_ref_.is_profiler_registered( ) )
+                {
+                    scope.emplace( service_locator_ref_.profiler( ), system.name( ), profile_category::system );
+                }
+#endif
+                system.tick( registry_ref_, service_locator_ref_ );
+            }
+            system.last_run_tick_ = run_tick;
+            registry_ref_.advance_tick( );
+        }
+
+
+#ifdef RST_ENABLE_PROFILING
+        [[nodiscard]] static auto hook_name( THook const hook ) -> std::string_view
+        {
+            if constexpr ( requires { meta::enum_traits<THook>::names; } )
+            {
+                return meta::enum_traits<THook>::names[std::to_underlying( hook )];
+            }
+            else
+            {
+                static std::array<std::string, meta::enum_traits<THook>::count> const names = []
+                {
+                    std::array<std::string, meta::enum_traits<THook>::count> result{};
+                    for ( std::size_t i = 0U; i < result.size( ); ++i ) { result[i] = std::format( "hook {}", i ); }
+                    return result;
+                }( );
+                return names[std::to_underlying( hook )];
+            }
+        }
+#endif
+
+
+        auto run_parallel(
+            std::vector<unique_ref<base_system>>& systems, hook_graph& graph, thread::worker_pool& pool ) noexcept -> void
+        {
+            for ( std::size_t node = 0U; node < systems.size( ); ++node )
+            {
+                graph.pending[node].store( graph.dependency_counts[node], std::memory_order_relaxed );
+            }
+
+            thread::task_group group{};
+            for ( std::size_t node = 0U; node < systems.size( ); ++node )
+            {
+                if ( graph.dependency_counts[node] == 0U && not systems[node]->access( ).is_exclusive( ) )
+                {
+                    submit_node( systems, graph, pool, group, node );
+                }
+            }
+
+            // an exclusive system conflicts with everything: once the pool is drained every earlier system has
+            // finished and no later one has started, so it runs here, on the thread that owns SDL and friends
+            for ( std::size_t node = 0U; node < systems.size( ); ++node )
+            {
+                pool.wait( group );
+                if ( systems[node]->access( ).is_exclusive( ) )
+                {
+                    run_node( systems, graph, pool, group, node );
+                }
+            }
+            pool.wait( group );
+        }
+
+
+        auto submit_node(
+            std::vector<unique_ref<base_system>>& systems, hook_graph& graph, thread::worker_pool& pool,
+            thread::task_group& group, std::size_t const node ) noexcept -> void
+        {
+            pool.submit(
+                group, [this, &systems, &graph, &pool, &group, node]
+                {
+                    run_node( systems, graph, pool, group, node );
+                } );
+        }
+
+
+        auto run_node(
+            std::vector<unique_ref<base_system>>& systems, hook_graph& graph, thread::worker_pool& pool,
+            thread::task_group& group, std::size_t const node ) noexcept -> void
+        {
+            tick_system( *systems[node] );
+
+            // the last predecessor to finish starts the successor, exclusive ones are left to run_parallel
+            for ( std::size_t const successor : graph.successors[node] )
+            {
+                if ( graph.pending[successor].fetch_sub( 1U, std::memory_order_acq_rel ) == 1U &&
+                     not systems[successor]->access( ).is_exclusive( ) )
+                {
+                    submit_node( systems, graph, pool, group, successor );
+                }
+            }
+        }
     };
 }
 
@@ -59,6 +59,7 @@ namespace rst
      * - max_value: Highest enumeration value for bounds checking
      * - count: Total number of enumeration values for array sizing
      * - is_sequential: Indicates values are sequential starting from 0
+     * - names: Display names, used by profiling
      *
      * @note Static assertions verify enumeration layout assumptions
      */
@@ -69,6 +70,12 @@ namespace rst
         static constexpr std::size_t count  = std::to_underlying( max_value ) + 1U; ///< Total number of timing phases
         static constexpr bool is_sequential = true;                                 ///< Values are sequential from 0
 
+        // display names, indexed by value
+        static constexpr std::array<std::string_view, count> names{
+            "early_tick", "fixed_tick", "pre_physics", "physics", "post_physics",
+            "tick", "late_tick", "pre_render", "render", "post_render"
+        };
+
         // Compile-time verification of enumeration layout
         static_assert( std::to_underlying( system_timing::early_tick ) == 0U );
         static_assert( count == 10U );
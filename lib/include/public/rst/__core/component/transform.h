@@ -338,6 +338,7 @@ namespace rst
      * - Hierarchical parent-child relationships with intrusive linked list.
      * - Lazy world transform computation with dirty flagging.
      * - Cache-friendly POD layout suitable for ECS sparse set storage.
+     * - Pointer-stable pool, the hierarchy pointers survive other transforms being added or removed.
      * - Const-correct access patterns for both read and write operations.
      *
      * Usage:
@@ -353,13 +354,17 @@ namespace rst
      * glm::vec2 world_pos = child.world().location(); // {110.0f, 70.0f}
      * @endcode
      */
-    //todo: transform might be relocated (sparse set)
     class transform
     {
         friend class detail::transform_operator<transform, detail::transform_space::local>;
         friend class detail::transform_operator<transform, detail::transform_space::world>;
 
     public:
+        /**
+         * Parents and children point to each other, the registry must never move a transform (see component_traits).
+         */
+        static constexpr bool pointer_stable{ true };
+
         /**
          * @brief Default constructor creating identity transform.
          *
@@ -2,14 +2,27 @@
 #define RST_ECS_H
 
 
+#include <rst/__core/__ecs/archetype.h>
+#include <rst/__core/__ecs/archetype_registry.h>
+#include <rst/__core/__ecs/archetype_view.h>
+#include <rst/__core/__ecs/command_buffer.h>
 #include <rst/__core/__ecs/component_constraints.h>
+#include <rst/__core/__ecs/component_signals.h>
+#include <rst/__core/__ecs/component_traits.h>
 #include <rst/__core/__ecs/ecs_error.h>
 #include <rst/__core/__ecs/entity.h>
 #include <rst/__core/__ecs/entity_allocator.h>
 #include <rst/__core/__ecs/entity_handle.h>
+#include <rst/__core/__ecs/group.h>
+#include <rst/__core/__ecs/prefab.h>
 #include <rst/__core/__ecs/registry.h>
 #include <rst/__core/__ecs/registry_pool.h>
+#include <rst/__core/__ecs/runtime_view.h>
+#include <rst/__core/__ecs/signature_table.h>
+#include <rst/__core/__ecs/snapshot.h>
+#include <rst/__core/__ecs/staging_area.h>
 #include <rst/__core/__ecs/view.h>
+#include <rst/__core/__ecs/view_filter.h>
 
 
 #endif //!RST_ECS_H
@@ -4,6 +4,7 @@
 #include <rst/pch.h>
 
 #include <rst/__core/__ecs/registry.h>
+#include <rst/__core/__ecs/staging_area.h>
 #include <rst/__core/__service/service_locator.h>
 #include <rst/__core/__system/system_scheduler.h>
 #include <rst/__core/__system/system_timing.h>
@@ -36,6 +37,7 @@ namespace rst
         auto operator=( hare&& ) noexcept -> hare& = delete;
 
         [[nodiscard]] auto registry( ) noexcept -> ecs::registry&;
+        [[nodiscard]] auto staging( ) noexcept -> ecs::staging_area&;
         [[nodiscard]] auto service_locator( ) noexcept -> service_locator&;
         [[nodiscard]] auto scheduler( ) noexcept -> system_scheduler<system_timing>&;
 
@@ -46,6 +48,7 @@ namespace rst
         bool request_quit_{ false };
 
         ecs::registry registry_{};
+        ecs::staging_area staging_{};
         rst::service_locator service_locator_{};
         system_scheduler<system_timing> scheduler_{ registry_, service_locator_ };
 
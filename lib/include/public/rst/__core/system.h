@@ -3,7 +3,9 @@
 
 
 #include <rst/__core/__system/base_system.h>
+#include <rst/__core/__system/frame_profiler.h>
 #include <rst/__core/__system/renderer_system.h>
+#include <rst/__core/__system/system_access.h>
 #include <rst/__core/__system/system_scheduler.h>
 #include <rst/__core/__system/system_timing.h>
 
@@ -0,0 +1,144 @@
+#ifndef RST_MEMORY_RESOURCE_H
+#define RST_MEMORY_RESOURCE_H
+
+#include <rst/pch.h>
+
+
+namespace rst::memory
+{
+    /**
+     * @brief Allocation counters of a memory resource.
+     */
+    struct allocation_stats final
+    {
+        std::size_t bytes_in_use{ 0U };  ///< Bytes allocated and not deallocated yet
+        std::size_t peak_bytes{ 0U };    ///< Highest bytes_in_use seen, the size an arena needs
+        std::size_t allocations{ 0U };   ///< Number of allocate calls
+        std::size_t deallocations{ 0U }; ///< Number of deallocate calls
+
+
+        auto operator+=( allocation_stats const& other ) noexcept -> allocation_stats&
+        {
+            bytes_in_use += other.bytes_in_use;
+            peak_bytes += other.peak_bytes;
+            allocations += other.allocations;
+            deallocations += other.deallocations;
+            return *this;
+        }
+    };
+
+
+    /**
+     * @brief Memory resource forwarding to an upstream resource and counting what goes through it.
+     *
+     * Gives a container (or a group of them) its own allocation_stats while the memory still comes from a shared
+     * resource, e.g. a level arena.
+     *
+     * @code
+     * counting_resource counter{ &arena };
+     * std::pmr::vector<int> values{ &counter };
+     * values.resize( 1'000 );
+     * assert( counter.stats( ).bytes_in_use >= 1'000 * sizeof( int ) );
+     * @endcode
+     *
+     * @note Not thread-safe, like the containers it serves.
+     */
+    class counting_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit counting_resource( std::pmr::memory_resource* upstream = std::pmr::get_default_resource( ) ) noexcept;
+        ~counting_resource( ) noexcept override = default;
+
+        counting_resource( counting_resource const& )                        = delete;
+        counting_resource( counting_resource&& ) noexcept                    = delete;
+        auto operator=( counting_resource const& ) -> counting_resource&     = delete;
+        auto operator=( counting_resource&& ) noexcept -> counting_resource& = delete;
+
+        [[nodiscard]] auto upstream( ) const noexcept -> std::pmr::memory_resource*;
+        [[nodiscard]] auto stats( ) const noexcept -> allocation_stats;
+
+    private:
+        std::pmr::memory_resource* const upstream_ptr_;
+        allocation_stats stats_{};
+
+        auto do_allocate( std::size_t bytes, std::size_t alignment ) -> void* override;
+        auto do_deallocate( void* ptr, std::size_t bytes, std::size_t alignment ) -> void override;
+        [[nodiscard]] auto do_is_equal( std::pmr::memory_resource const& other ) const noexcept -> bool override;
+    };
+
+
+    /**
+     * @brief Monotonic memory resource over a block reserved up front, released all at once.
+     *
+     * Allocations bump a pointer through the block and deallocations are no-ops. Once the block is exhausted the
+     * arena keeps going with blocks from the upstream resource, and the stats show by how much the initial size
+     * fell short. reset( ) makes the whole block available again and returns the extra blocks upstream.
+     *
+     * Two uses in the engine:
+     * - Level arena: a registry built on it (see ecs::registry) carves its whole storage out of the block, and
+     * unloading the level destroys the registry and then the arena, without a single deallocation in between.
+     * - Frame scratch: the service_locator keeps one per thread of the worker pool (see frame_scratch( )), reset at
+     * the end of every frame, for temporaries that never outlive the frame.
+     *
+     * @code
+     * memory::monotonic_arena level_arena{ 64U << 20U };
+     * {
+     *     ecs::registry level{ &level_arena };
+     *     // load and play the level...
+     * }
+     * alert( "level used {} bytes at most", level_arena.stats( ).peak_bytes );
+     * @endcode
+     *
+     * @note Not thread-safe. Anything allocated from the arena must be gone before reset( ) or its destruction.
+     */
+    class monotonic_arena final : public std::pmr::memory_resource
+    {
+    public:
+        explicit monotonic_arena(
+            std::size_t initial_bytes, std::pmr::memory_resource* upstream = std::pmr::get_default_resource( ) );
+        ~monotonic_arena( ) noexcept override;
+
+        monotonic_arena( monotonic_arena const& )                        = delete;
+        monotonic_arena( monotonic_arena&& ) noexcept                    = delete;
+        auto operator=( monotonic_arena const& ) -> monotonic_arena&     = delete;
+        auto operator=( monotonic_arena&& ) noexcept -> monotonic_arena& = delete;
+
+        /**
+         * @brief Drops every allocation at once, the initial block is kept for the next ones.
+         * @complexity O(b) where b is the number of extra blocks taken from upstream
+         */
+        auto reset( ) noexcept -> void;
+
+        /**
+         * @return Bytes handed out since the last reset and the most ever handed out between two resets. The
+         * arena never deallocates, so bytes_in_use only grows until reset
+         */
+        [[nodiscard]] auto stats( ) const noexcept -> allocation_stats;
+
+        /**
+         * @return Bytes of the initial block
+         */
+        [[nodiscard]] auto initial_capacity( ) const noexcept -> std::size_t;
+
+        /**
+         * @return Bytes currently taken from upstream past the initial block, zero while the block was enough
+         */
+        [[nodiscard]] auto overflow_bytes( ) const noexcept -> std::size_t;
+
+    private:
+        std::pmr::memory_resource* const upstream_ptr_;
+        std::size_t const initial_bytes_;
+        void* const initial_block_ptr_;
+
+        counting_resource overflow_;
+        std::pmr::monotonic_buffer_resource buffer_;
+        allocation_stats stats_{};
+
+        auto do_allocate( std::size_t bytes, std::size_t alignment ) -> void* override;
+        auto do_deallocate( void* ptr, std::size_t bytes, std::size_t alignment ) -> void override;
+        [[nodiscard]] auto do_is_equal( std::pmr::memory_resource const& other ) const noexcept -> bool override;
+    };
+}
+
+
+#endif //!RST_MEMORY_RESOURCE_H
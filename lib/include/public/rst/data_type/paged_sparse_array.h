@@ -0,0 +1,238 @@
+#ifndef RST_PAGED_SPARSE_ARRAY_H
+#define RST_PAGED_SPARSE_ARRAY_H
+
+#include <rst/pch.h>
+
+
+namespace rst
+{
+    /**
+     * @brief A sparse array split into fixed-size pages that are only allocated when written to.
+     *
+     * Behaves like a flat array of TValue that is zero (null) everywhere it was never assigned, but memory is
+     * only committed for pages that contain at least one assigned slot. Unallocated pages all point to a single
+     * shared, zeroed null page, so reads never branch on page presence: a read is one bounds check on the page
+     * table plus two dependent loads.
+     *
+     * Key features:
+     * - O(1) reads and writes, no hashing.
+     * - Memory proportional to the number of touched pages, not to the largest index ever written.
+     * - Reads of unassigned slots (in range or out of range) return the null value without allocating.
+     * - Clearing releases every page, shrink_to_fit releases the pages left empty.
+     * - Page table and pages allocated from a std::pmr::memory_resource, the default one unless told otherwise.
+     *
+     * @code
+     * paged_sparse_array<uint32_t> sparse{};
+     *
+     * sparse.assign( 1'000'000U, 42U ); // allocates one page, not one million slots
+     * assert( sparse[1'000'000U] == 42U );
+     * assert( sparse[7U] == 0U );       // reads from the shared null page
+     *
+     * sparse.reset( 1'000'000U );       // back to null, page is kept for reuse
+     * sparse.clear( );                  // every page is released
+     * @endcode
+     *
+     * @tparam TValue Unsigned integral value type, zero is the null value
+     * @tparam page_size Number of slots per page, must be a power of two
+     */
+    template <std::unsigned_integral TValue, std::size_t page_size = 4096U> requires ( std::has_single_bit( page_size ) )
+    class paged_sparse_array final
+    {
+        using page_type = std::array<TValue, page_size>;
+
+    public:
+        using value_type = TValue;
+
+        /**
+         * Value read from any slot that was never assigned.
+         */
+        static constexpr value_type null_value{ 0U };
+
+
+        paged_sparse_array( ) noexcept = default;
+
+        /**
+         * @param resource Where the page table and the pages are allocated from, must outlive the array
+         */
+        explicit paged_sparse_array( std::pmr::memory_resource* const resource ) noexcept : pages_{ resource } { }
+
+        ~paged_sparse_array( ) noexcept { release_pages( ); }
+
+        paged_sparse_array( paged_sparse_array const& )                    = delete;
+        auto operator=( paged_sparse_array const& ) -> paged_sparse_array& = delete;
+
+        paged_sparse_array( paged_sparse_array&& other ) noexcept
+            : pages_{ std::move( other.pages_ ) }
+            , allocated_pages_{ std::exchange( other.allocated_pages_, 0U ) } { }
+
+
+        auto operator=( paged_sparse_array&& other ) noexcept -> paged_sparse_array&
+        {
+            assert( pages_.get_allocator( ) == other.pages_.get_allocator( ) &&
+                    "paged_sparse_array::operator=: pages belong to another resource!" );
+            if ( this != &other )
+            {
+                release_pages( );
+                pages_           = std::move( other.pages_ );
+                allocated_pages_ = std::exchange( other.allocated_pages_, 0U );
+            }
+            return *this;
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @param index The slot to read
+         * @return The value at @index, or null_value if the slot was never assigned
+         */
+        [[nodiscard]] auto operator[]( std::size_t const index ) const noexcept -> value_type
+        {
+            std::size_t const page = page_of( index );
+            return page < pages_.size( ) ? ( *pages_[page] )[offset_of( index )] : null_value;
+        }
+
+
+        /**
+         * @brief Writes a value, allocating the page that contains @index if needed.
+         * @complexity O(1) amortized (may allocate a page and grow the page table)
+         * @param index The slot to write
+         * @param value The value to store
+         */
+        auto assign( std::size_t const index, value_type const value ) -> void
+        {
+            ( *ensure_page( page_of( index ) ) )[offset_of( index )] = value;
+        }
+
+
+        /**
+         * @brief Writes null_value at @index. Never allocates.
+         * @complexity O(1)
+         * @param index The slot to reset
+         */
+        auto reset( std::size_t const index ) noexcept -> void
+        {
+            if ( std::size_t const page = page_of( index ); page < pages_.size( ) && pages_[page] != &null_page_ )
+            {
+                ( *pages_[page] )[offset_of( index )] = null_value;
+            }
+        }
+
+
+        /**
+         * @brief Releases every page and empties the page table.
+         * @complexity O(p) where p is the number of allocated pages
+         */
+        auto clear( ) noexcept -> void
+        {
+            release_pages( );
+            pages_.clear( );
+        }
+
+
+        /**
+         * @brief Releases the pages where every slot is null, then the page table entries past the last page left.
+         * @complexity O(p) page compares where p is the number of allocated pages
+         */
+        auto shrink_to_fit( ) -> void
+        {
+            for ( page_type*& page : pages_ )
+            {
+                if ( page != &null_page_ && *page == null_page_ )
+                {
+                    page_allocator( ).delete_object( page );
+                    page = &null_page_;
+                    --allocated_pages_;
+                }
+            }
+            while ( not pages_.empty( ) && pages_.back( ) == &null_page_ ) { pages_.pop_back( ); }
+            pages_.shrink_to_fit( );
+        }
+
+
+        /**
+         * @return Number of entries in the page table, allocated or not
+         */
+        [[nodiscard]] auto page_count( ) const noexcept -> std::size_t { return pages_.size( ); }
+
+
+        /**
+         * @return Number of pages that own memory
+         */
+        [[nodiscard]] auto allocated_pages( ) const noexcept -> std::size_t { return allocated_pages_; }
+
+
+        /**
+         * @return Number of addressable slots before the page table has to grow
+         */
+        [[nodiscard]] auto extent( ) const noexcept -> std::size_t { return pages_.size( ) * page_size; }
+
+
+        /**
+         * @return Bytes owned by the page table and the allocated pages
+         */
+        [[nodiscard]] auto memory_usage( ) const noexcept -> std::size_t
+        {
+            return pages_.capacity( ) * sizeof( page_type* ) + allocated_pages_ * sizeof( page_type );
+        }
+
+    private:
+        static constexpr std::size_t page_shift_{ std::countr_zero( page_size ) };
+        static constexpr std::size_t page_mask_{ page_size - 1U };
+
+        // shared by every unallocated page table entry, never written to
+        alignas( 64 ) static inline page_type null_page_{};
+
+        std::pmr::vector<page_type*> pages_{};
+        std::size_t allocated_pages_{ 0U };
+
+
+        [[nodiscard]] static constexpr auto page_of( std::size_t const index ) noexcept -> std::size_t
+        {
+            return index >> page_shift_;
+        }
+
+
+        [[nodiscard]] static constexpr auto offset_of( std::size_t const index ) noexcept -> std::size_t
+        {
+            return index & page_mask_;
+        }
+
+
+        [[nodiscard]] auto ensure_page( std::size_t const page ) -> page_type*
+        {
+            if ( page >= pages_.size( ) )
+            {
+                pages_.resize( page + 1U, &null_page_ );
+            }
+            if ( pages_[page] == &null_page_ )
+            {
+                pages_[page] = page_allocator( ).template new_object<page_type>( );
+                ++allocated_pages_;
+            }
+            return pages_[page];
+        }
+
+
+        [[nodiscard]] auto page_allocator( ) const noexcept -> std::pmr::polymorphic_allocator<page_type>
+        {
+            return pages_.get_allocator( );
+        }
+
+
+        auto release_pages( ) noexcept -> void
+        {
+            for ( page_type*& page : pages_ )
+            {
+                if ( page != &null_page_ )
+                {
+                    page_allocator( ).delete_object( page );
+                    page = &null_page_;
+                }
+            }
+            allocated_pages_ = 0U;
+        }
+    };
+}
+
+
+#endif //!RST_PAGED_SPARSE_ARRAY_H
@@ -4,6 +4,8 @@
 #include <rst/pch.h>
 
 #include <rst/data_type/data_structure_error.h>
+#include <rst/data_type/memory_resource.h>
+#include <rst/data_type/paged_sparse_array.h>
 #include <rst/data_type/ref_proxy.h>
 #include <rst/meta/algorithm.h>
 
@@ -16,9 +18,267 @@ namespace rst
         template <typename T>
         concept sparse_set_element = std::is_default_constructible_v<T> && not std::is_reference_v<T> &&
             std::is_move_assignable_v<std::remove_cv_t<T>>;
+
+
+        template <typename T, typename TIndex>
+        concept sparse_set_traits = requires( TIndex index )
+        {
+            { T::to_index( index ) } noexcept -> std::convertible_to<std::size_t>;
+            { T::is_versioned } -> std::convertible_to<bool>;
+        };
+
+
+        /**
+         * Added and changed stamps of a tick-tracking set, parallel to its packed array.
+         */
+        struct sparse_tick_columns final
+        {
+            using tick_type = uint32_t;
+
+            explicit sparse_tick_columns( std::pmr::memory_resource* const resource ) noexcept
+                : added{ resource }
+                , changed{ resource } { }
+
+            std::pmr::vector<tick_type> added;
+            std::pmr::vector<tick_type> changed;
+            std::atomic<tick_type> const* clock_ptr{ nullptr };
+
+            [[nodiscard]] auto now( ) const noexcept -> tick_type
+            {
+                return clock_ptr != nullptr ? clock_ptr->load( std::memory_order_relaxed ) : tick_type{ 0U };
+            }
+        };
+
+
+        /**
+         * Stand-in for sparse_tick_columns in sets that do not track ticks, takes no space.
+         */
+        struct sparse_no_ticks final
+        {
+            sparse_no_ticks( ) noexcept = default;
+            explicit sparse_no_ticks( std::pmr::memory_resource* ) noexcept { }
+        };
+
+
+        /**
+         * Stand-in for the element array of sets whose element type is empty (tags). Stores nothing and takes no
+         * space: every position refers to the same instance, as every instance of an empty type is alike.
+         */
+        template <typename T>
+        class sparse_tag_elements final
+        {
+        public:
+            explicit sparse_tag_elements( std::pmr::memory_resource* ) noexcept { }
+
+            auto reserve( std::size_t ) noexcept -> void { }
+            auto resize( std::size_t ) noexcept -> void { }
+            auto append( std::span<T const> ) noexcept -> void { }
+            auto append( std::size_t, T const& ) noexcept -> void { }
+            auto pop_back( ) noexcept -> void { }
+            auto clear( ) noexcept -> void { }
+            auto shrink_to_fit( ) noexcept -> void { }
+
+            [[nodiscard]] auto capacity( ) const noexcept -> std::size_t { return 0U; }
+
+
+            template <typename... TArgs>
+            auto emplace_back( TArgs&&... args ) noexcept(std::is_nothrow_constructible_v<T, TArgs...>) -> T&
+            {
+                instance_ = T( std::forward<TArgs>( args )... );
+                return instance_;
+            }
+
+
+            [[nodiscard]] auto operator[]( std::size_t ) noexcept -> T& { return instance_; }
+            [[nodiscard]] auto operator[]( std::size_t ) const noexcept -> T const& { return instance_; }
+
+        private:
+            [[no_unique_address]] T instance_{};
+        };
+
+
+        /**
+         * Element array of pointer-stable sets: fixed-size pages that are never moved once allocated, so growing the
+         * set leaves every element where it is. Every slot holds a value, unused ones a default constructed one.
+         */
+        template <typename T>
+        class sparse_stable_elements final
+        {
+        public:
+            // pages of about 16 KiB, at least one element
+            static constexpr std::size_t page_size{ std::bit_floor( std::max<std::size_t>( 16'384U / sizeof( T ), 1U ) ) };
+
+
+            explicit sparse_stable_elements( std::pmr::memory_resource* const resource ) noexcept : pages_{ resource } { }
+
+            ~sparse_stable_elements( ) noexcept
+            {
+                std::pmr::polymorphic_allocator<T> allocator = pages_.get_allocator( );
+                for ( T* const page : pages_ )
+                {
+                    std::destroy_n( page, page_size );
+                    allocator.deallocate( page, page_size );
+                }
+            }
+
+            sparse_stable_elements( sparse_stable_elements const& )                        = delete;
+            sparse_stable_elements( sparse_stable_elements&& ) noexcept                    = delete;
+            auto operator=( sparse_stable_elements const& ) -> sparse_stable_elements&     = delete;
+            auto operator=( sparse_stable_elements&& ) noexcept -> sparse_stable_elements& = delete;
+
+
+            auto reserve( std::size_t const count ) -> void
+            {
+                std::pmr::polymorphic_allocator<T> allocator = pages_.get_allocator( );
+                while ( pages_.size( ) * page_size < count )
+                {
+                    pages_.reserve( pages_.size( ) + 1U );
+                    T* const page = allocator.allocate( page_size );
+                    std::uninitialized_value_construct_n( page, page_size );
+                    pages_.push_back( page );
+                }
+            }
+
+
+            template <typename... TArgs>
+            auto emplace_back( TArgs&&... args ) -> T&
+            {
+                reserve( size_ + 1U );
+                return assign( size_++, std::forward<TArgs>( args )... );
+            }
+
+
+            template <typename... TArgs>
+            auto assign( std::size_t const pos, TArgs&&... args ) -> T&
+            {
+                T& slot = ( *this )[pos];
+                slot    = T( std::forward<TArgs>( args )... );
+                return slot;
+            }
+
+
+            // copies @values past the last element, a page at a time
+            auto append( std::span<T const> values ) -> void
+            {
+                reserve( size_ + values.size( ) );
+                while ( not values.empty( ) )
+                {
+                    std::size_t const count = std::min( values.size( ), page_size - size_ % page_size );
+                    std::ranges::copy( values.first( count ), pages_[size_ / page_size] + size_ % page_size );
+                    size_ += count;
+                    values = values.subspan( count );
+                }
+            }
+
+
+            // writes @count copies of @value past the last element, a page at a time
+            auto append( std::size_t count, T const& value ) -> void
+            {
+                reserve( size_ + count );
+                while ( count > 0U )
+                {
+                    std::size_t const run = std::min( count, page_size - size_ % page_size );
+                    std::fill_n( pages_[size_ / page_size] + size_ % page_size, run, value );
+                    size_ += run;
+                    count -= run;
+                }
+            }
+
+
+            // gives the slot its default value back, releasing whatever the element held
+            auto reset( std::size_t const pos ) -> void { ( *this )[pos] = T{ }; }
+
+
+            auto clear( ) -> void
+            {
+                for ( std::size_t pos = 0U; pos < size_; ++pos ) { reset( pos ); }
+                size_ = 0U;
+            }
+
+
+            // forgets the slots from @count on, they already hold default values
+            auto truncate( std::size_t const count ) noexcept -> void
+            {
+                assert( count <= size_ && "sparse_set::truncate: count past the end!" );
+                size_ = count;
+            }
+
+
+            // releases the pages past the one holding the last element, the elements left keep their address
+            auto shrink_to_fit( ) -> void
+            {
+                std::pmr::polymorphic_allocator<T> allocator = pages_.get_allocator( );
+                std::size_t const used_pages = ( size_ + page_size - 1U ) / page_size;
+                while ( pages_.size( ) > used_pages )
+                {
+                    std::destroy_n( pages_.back( ), page_size );
+                    allocator.deallocate( pages_.back( ), page_size );
+                    pages_.pop_back( );
+                }
+                pages_.shrink_to_fit( );
+            }
+
+
+            [[nodiscard]] auto capacity( ) const noexcept -> std::size_t { return pages_.size( ) * page_size; }
+
+
+            [[nodiscard]] auto operator[]( std::size_t const pos ) noexcept -> T&
+            {
+                return pages_[pos / page_size][pos % page_size];
+            }
+
+
+            [[nodiscard]] auto operator[]( std::size_t const pos ) const noexcept -> T const&
+            {
+                return pages_[pos / page_size][pos % page_size];
+            }
+
+
+            [[nodiscard]] auto page_data( std::size_t const first, std::size_t const count ) noexcept -> std::span<T>
+            {
+                assert( ( count == 0U || first / page_size == ( first + count - 1U ) / page_size ) &&
+                        "sparse_set::page_data: range spans two pages!" );
+                return { pages_[first / page_size] + first % page_size, count };
+            }
+
+        private:
+            std::pmr::vector<T*> pages_;
+            std::size_t size_{ 0U };
+        };
+
+
+        /**
+         * Stand-in for the free list of sets that are not pointer-stable, takes no space.
+         */
+        struct sparse_no_free_list final
+        {
+            explicit sparse_no_free_list( std::pmr::memory_resource* ) noexcept { }
+        };
     }
 
 
+    // +--------------------------------+
+    // | SPARSE SET TRAITS              |
+    // +--------------------------------+
+    /**
+     * @brief Default sparse_set traits: the whole index addresses the sparse array.
+     *
+     * Custom traits let an index carry extra bits (e.g. a version) that are not part of the sparse slot. When
+     * is_versioned is true, only to_index( index ) addresses the sparse array and has( ) additionally compares
+     * the full index stored in the packed array, so handles that share a slot but differ in the extra bits are
+     * rejected.
+     *
+     * @tparam TIndex The index type
+     */
+    template <std::unsigned_integral TIndex>
+    struct sparse_identity_traits final
+    {
+        static constexpr bool is_versioned{ false };
+
+        [[nodiscard]] static constexpr auto to_index( TIndex const index ) noexcept -> TIndex { return index; }
+    };
+
+
     // +--------------------------------+
     // | BASE SPARSE SET CLASS          |
     // +--------------------------------+
@@ -29,6 +289,28 @@ namespace rst
         using index_type        = TIndex;
         using sparse_index_type = TIndex;
 
+        /**
+         * Position returned for indices that are not in the set.
+         */
+        static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max( ) };
+
+        /**
+         * Index left in the packed array of pointer-stable sets at the position of a removed element. It is never
+         * in the set, so walking the packed array and checking has( ) skips it.
+         */
+        static constexpr index_type tombstone{ std::numeric_limits<index_type>::max( ) };
+
+        /**
+         * Contiguous run of elements seen without their type: element i of the run lives at data + i * stride.
+         * Tag sets have a stride of 0, every element of the run being the same shared instance.
+         */
+        struct erased_run final
+        {
+            std::byte* data{ nullptr };
+            std::size_t stride{ 0U };
+            std::size_t length{ 0U };
+        };
+
 
         base_sparse_set( ) noexcept          = default;
         virtual ~base_sparse_set( ) noexcept = default;
@@ -39,13 +321,26 @@ namespace rst
         auto operator=( base_sparse_set&& ) noexcept -> base_sparse_set& = delete;
 
         [[nodiscard]] virtual auto has( index_type index ) const noexcept -> bool = 0;
+        [[nodiscard]] virtual auto position( index_type index ) const noexcept -> std::size_t = 0;
         virtual auto remove( index_type index ) -> void = 0;
+        virtual auto remove( std::span<index_type const> indices ) -> void = 0;
+        virtual auto swap_positions( std::size_t lhs, std::size_t rhs ) -> void = 0;
         virtual auto clear( ) -> void = 0;
+        virtual auto shrink_to_fit( ) -> void = 0;
 
         [[nodiscard]] virtual auto packed( ) const noexcept -> std::span<index_type const> = 0;
         [[nodiscard]] virtual auto size( ) const noexcept -> std::size_t = 0;
         [[nodiscard]] virtual auto capacity( ) const noexcept -> std::size_t = 0;
         [[nodiscard]] virtual auto empty( ) const noexcept -> bool = 0;
+        [[nodiscard]] virtual auto memory_usage( ) const noexcept -> std::size_t = 0;
+        [[nodiscard]] virtual auto allocation_stats( ) const noexcept -> memory::allocation_stats = 0;
+
+        /**
+         * @param first A packed position
+         * @return The longest run of elements starting at packed position @first that sits in one block of memory,
+         * empty past the end of the set
+         */
+        [[nodiscard]] virtual auto erased_elements( std::size_t first ) noexcept -> erased_run = 0;
     };
 
 
@@ -59,11 +354,21 @@ namespace rst
      * array for cache-friendly iteration. Ideal for ECS component storage where entity
      * IDs may be sparse but component iteration should be packed.
      *
+     * The sparse array is paged (see paged_sparse_array): pages are only allocated for index
+     * ranges that actually hold an element, so a set holding a handful of high indices does not
+     * pay for every index below them.
+     *
      * Key features:
      * - O(1) insertion, removal, and lookup operations.
+     * - Sparse memory bounded by the touched index pages, not by the largest index.
      * - Cache-friendly packed iteration over elements.
      * - Stable indices during insertion (existing elements don't move).
      * - Swap-and-pop removal maintains packed storage efficiency.
+     * - In-place sorting by element, or to follow the order of another set.
+     * - Empty element types (tags) store only the indices, see tag_span.
+     * - Opt-in pointer stability: paged elements and tombstones instead of swap-and-pop, see pointer_stable.
+     * - Every array allocated from one std::pmr::memory_resource, counted per set (see allocation_stats).
+     * - Peak capacity given back on demand, see shrink_to_fit.
      * - Support for both const and mutable element types.
      *
      * @code
@@ -98,8 +403,16 @@ namespace rst
      *
      * @tparam TElement The type of elements stored (must be default constructible and move assignable)
      * @tparam TIndex The index type (must be unsigned integral, defaults to uint32_t)
+     * @tparam TTraits How an index maps to its sparse slot (see sparse_identity_traits)
+     * @tparam tracks_ticks Whether every element carries an added and a changed tick (see bind_clock). Sets that
+     * do not track ticks store nothing for them
+     * @tparam pointer_stable Whether an element keeps its address for as long as it is in the set. The elements
+     * live in fixed-size pages (see page_data) and removing one leaves a tombstone in the packed array, reused by
+     * the next insertion. Pointer-stable sets cannot be sorted nor have their positions swapped. Ignored for tags
      */
-    template <internal::sparse_set_element TElement, std::unsigned_integral TIndex = uint32_t>
+    template <internal::sparse_set_element TElement, std::unsigned_integral TIndex = uint32_t,
+              internal::sparse_set_traits<TIndex> TTraits = sparse_identity_traits<TIndex>, bool tracks_ticks = false,
+              bool pointer_stable = false>
     class sparse_set final : public base_sparse_set<TIndex>
     {
     public:
@@ -112,8 +425,16 @@ namespace rst
 
         using index_type        = base_sparse_set<TIndex>::index_type;
         using sparse_index_type = base_sparse_set<TIndex>::sparse_index_type;
+        using tick_type         = internal::sparse_tick_columns::tick_type;
 
         static constexpr bool is_const_set = std::is_const_v<TElement>;
+        static constexpr bool is_tick_tracked = tracks_ticks;
+        static constexpr bool is_tag_set = std::is_empty_v<value_type>;
+        static constexpr bool is_pointer_stable = pointer_stable && not is_tag_set;
+        static constexpr std::size_t npos   = base_sparse_set<TIndex>::npos;
+        static constexpr index_type tombstone = base_sparse_set<TIndex>::tombstone;
+
+        using erased_run = base_sparse_set<TIndex>::erased_run;
 
         /**
          * Value representing a null element in the sparse array.
@@ -121,14 +442,54 @@ namespace rst
         static constexpr index_type null_element{ 0U };
 
 
+        sparse_set( ) noexcept : sparse_set{ std::pmr::get_default_resource( ) } { }
+
+        /**
+         * @param upstream Where every array of the set is allocated from, e.g. a level arena. Must outlive the set
+         */
+        explicit sparse_set( std::pmr::memory_resource* const upstream ) noexcept
+            : resource_{ upstream }
+            , sparse_{ &resource_ }
+            , packed_{ &resource_ }
+            // parentheses, an aggregate element could otherwise take the resource through an initializer list
+            , elements_( &resource_ )
+            , ticks_{ &resource_ }
+            , free_{ &resource_ } { }
+
+
         /**
          * @complexity O(1)
          * @param index The sparse index to check
-         * @return True if element exists at @index
+         * @return True if element exists at @index. With versioned traits, false for an index that shares the slot
+         * of a stored one but not its version
          */
         [[nodiscard]] auto has( index_type index ) const noexcept -> bool override
         {
-            return index < sparse_.size( ) && sparse_[index] != null_element;
+            if constexpr ( is_pointer_stable )
+            {
+                if ( index == tombstone ) { return false; }
+            }
+
+            sparse_index_type const slot = sparse_[key_of( index )];
+            if constexpr ( TTraits::is_versioned )
+            {
+                return slot != null_element && packed_[decode_sparse_index( slot )] == index;
+            }
+            else
+            {
+                return slot != null_element;
+            }
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @param index The sparse index to look up
+         * @return The position of @index in the packed and element arrays, or npos if it is not in the set
+         */
+        [[nodiscard]] auto position( index_type index ) const noexcept -> std::size_t override
+        {
+            return has( index ) ? decode_sparse_index( sparse_[key_of( index )] ) : npos;
         }
 
 
@@ -140,13 +501,98 @@ namespace rst
         {
             packed_.reserve( count );
             elements_.reserve( count );
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added.reserve( count );
+                ticks_.changed.reserve( count );
+            }
+        }
+
+
+        /**
+          * @brief Appends elements in bulk, copying the arrays as they are, e.g. to restore the set from a snapshot.
+          *
+          * @complexity O(n) where n is the number of indices: one copy per array, one sparse write per index
+          *
+          * @param indices The indices to add, none of them may be in the set
+          * @param elements The element of each index, in the same order. Ignored for tags
+          * @param added The added tick of each element, for tick-tracking sets. Empty to stamp the current tick
+          * @param changed The changed tick of each element, for tick-tracking sets. Empty to stamp the current tick
+          */
+        auto append(
+            std::span<index_type const> const indices, std::span<value_type const> const elements,
+            std::span<tick_type const> const added = { }, std::span<tick_type const> const changed = { } ) -> void
+            requires ( not is_const_set )
+        {
+            assert( ( is_tag_set || elements.size( ) == indices.size( ) ) && "sparse_set::append: one element per index!" );
+
+            std::size_t const first = packed_.size( );
+            reserve( first + indices.size( ) );
+
+            packed_.insert( packed_.end( ), indices.begin( ), indices.end( ) );
+            if constexpr ( is_tag_set || is_pointer_stable )
+            {
+                elements_.append( elements );
+            }
+            else
+            {
+                elements_.insert( elements_.end( ), elements.begin( ), elements.end( ) );
+            }
+            if constexpr ( tracks_ticks )
+            {
+                assert( ( added.empty( ) || added.size( ) == indices.size( ) ) &&
+                        ( changed.empty( ) || changed.size( ) == indices.size( ) ) &&
+                        "sparse_set::append: one tick per index!" );
+                auto const append_ticks = [&]( std::pmr::vector<tick_type>& column, std::span<tick_type const> const ticks )
+                {
+                    if ( ticks.empty( ) ) { column.resize( packed_.size( ), ticks_.now( ) ); }
+                    else { column.insert( column.end( ), ticks.begin( ), ticks.end( ) ); }
+                };
+                append_ticks( ticks_.added, added );
+                append_ticks( ticks_.changed, changed );
+            }
+
+            link_from( first );
+        }
+
+
+        /**
+          * @brief Appends a copy of @value for every index of @indices, e.g. to stamp out a prefab.
+          *
+          * @complexity O(n) where n is the number of indices: one fill per array, one sparse write per index
+          *
+          * @param indices The indices to add, none of them may be in the set
+          * @param value The element every index gets. Added and changed ticks are stamped with the current tick
+          */
+        auto append( std::span<index_type const> const indices, const_reference_type value ) -> void
+            requires ( not is_const_set )
+        {
+            std::size_t const first = packed_.size( );
+            reserve( first + indices.size( ) );
+
+            packed_.insert( packed_.end( ), indices.begin( ), indices.end( ) );
+            if constexpr ( is_tag_set || is_pointer_stable )
+            {
+                elements_.append( indices.size( ), value );
+            }
+            else
+            {
+                elements_.insert( elements_.end( ), indices.size( ), value );
+            }
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added.resize( packed_.size( ), ticks_.now( ) );
+                ticks_.changed.resize( packed_.size( ), ticks_.now( ) );
+            }
+
+            link_from( first );
         }
 
 
         /**
           * @brief Constructs an element at the given index with provided arguments.
           *
-          * @complexity O(1) amortized (may trigger array resize)
+          * @complexity O(1) amortized (may allocate a sparse page or grow the packed arrays)
           *
           * @tparam TArgs
           * @param index
@@ -157,18 +603,14 @@ namespace rst
         auto insert(
             index_type index, TArgs&&... args ) noexcept(std::is_nothrow_constructible_v<value_type>) -> expected_reference_type
         {
-            if ( has( index ) )
+            // the slot is checked rather than has( ), a different version holding it counts as taken
+            if ( sparse_[key_of( index )] != null_element )
             {
                 return std::unexpected{ data_structure_error::index_already_exists };
             }
 
-            // 1. ensure we can accommodate the index
-            ensure_size( index );
-
-            // 2. add new component
-            sparse_[index] = encode_sparse_index( static_cast<index_type>( packed_.size( ) ) );
-            packed_.emplace_back( index );
-            return elements_.emplace_back( std::forward<TArgs>( args )... );
+            // add new component, the sparse page is allocated on demand
+            return emplace_new( index, std::forward<TArgs>( args )... );
         }
 
 
@@ -176,7 +618,7 @@ namespace rst
           * @brief Constructs or replaces an element at the given index with provided arguments.
           * @note This function only works if TElement is not const
           *
-          * @complexity O(1) amortized (may trigger array resize)
+          * @complexity O(1) amortized (may allocate a sparse page or grow the packed arrays)
           *
           * @tparam TArgs
           * @param index
@@ -187,26 +629,24 @@ namespace rst
         auto insert_or_replace(
             index_type index, TArgs&&... args ) noexcept(std::is_nothrow_constructible_v<value_type>) -> reference_type
         {
-            // 1. ensure we can accommodate the index
-            ensure_size( index );
-
-            // 2a. if we already have this entry, we replace it...
+            // 1a. if we already have this entry, we replace it...
             if ( has( index ) )
             {
-                index_type const decoded = decode_sparse_index( sparse_[index] );
+                index_type const decoded = decode_sparse_index( sparse_[key_of( index )] );
                 elements_[decoded]       = value_type{ std::forward<TArgs>( args )... };
+                if constexpr ( tracks_ticks ) { ticks_.changed[decoded] = ticks_.now( ); }
                 return elements_[decoded];
             }
 
-            // 2b. ... else add new component
-            sparse_[index] = encode_sparse_index( static_cast<index_type>( packed_.size( ) ) );
-            packed_.emplace_back( index );
-            return elements_.emplace_back( std::forward<TArgs>( args )... );
+            // 1b. ... else add new component
+            assert( sparse_[key_of( index )] == null_element && "sparse_set::insert_or_replace: slot held by another version!" );
+            return emplace_new( index, std::forward<TArgs>( args )... );
         }
 
 
         /**
          * Removes the element at the given index if it exists. If the element is not the set, nothing happens.
+         * Pointer-stable sets leave a tombstone at its position instead of moving the last element there.
          * @complexity O(1)
          * @param index The index of the element to remove
          */
@@ -216,26 +656,213 @@ namespace rst
             if ( not has( index ) ) { return; }
 
             // 1. find the position of the element to remove in the packed array
-            index_type const element_pos      = decode_sparse_index( sparse_[index] );
-            index_type const last_element_pos = static_cast<index_type>( packed_.size( ) ) - 1U;
+            index_type const element_pos = decode_sparse_index( sparse_[key_of( index )] );
+
+            if constexpr ( is_pointer_stable )
+            {
+                // 2. bury the element where it is, the position goes to the free list for the next insertion
+                sparse_.reset( key_of( index ) );
+                packed_[element_pos] = tombstone;
+                elements_.reset( element_pos );
+                free_.push_back( element_pos );
+            }
+            else
+            {
+                index_type const last_element_pos = static_cast<index_type>( packed_.size( ) ) - 1U;
+
+                // 2. if not already removing the last element, swap with the last element to keep packed the array at low expense
+                if ( bool const is_last = element_pos == last_element_pos; not is_last )
+                {
+                    packed_[element_pos]          = packed_[last_element_pos];
+                    elements_[element_pos]        = std::move( elements_[last_element_pos] );
+                    sparse_.assign( key_of( packed_[element_pos] ), encode_sparse_index( element_pos ) );
+                    if constexpr ( tracks_ticks )
+                    {
+                        ticks_.added[element_pos]   = ticks_.added[last_element_pos];
+                        ticks_.changed[element_pos] = ticks_.changed[last_element_pos];
+                    }
+                }
+
+                // 3. remove last element and clear sparse mapping
+                sparse_.reset( key_of( index ) );
+                packed_.pop_back( );
+                elements_.pop_back( );
+                if constexpr ( tracks_ticks )
+                {
+                    ticks_.added.pop_back( );
+                    ticks_.changed.pop_back( );
+                }
+            }
+        }
 
-            // 2. if not already removing the last element, swap with the last element to keep packed the array at low expense
-            if ( bool const is_last = element_pos == last_element_pos; not is_last )
+
+        /**
+         * @brief Removes every element of @indices that is in the set, the others are skipped.
+         *
+         * Small batches are removed one by one with swap-and-pop. Once a batch covers a good part of the set, the
+         * removed slots are cleared first and the packed arrays are compacted in a single linear pass instead,
+         * which keeps the remaining elements in their relative order. Pointer-stable sets never compact, every
+         * element is buried where it is.
+         *
+         * @complexity O(k) where k is the number of indices, O(n + k) when compacting
+         * @param indices The indices of the elements to remove, in any order
+         */
+        auto remove( std::span<index_type const> const indices ) noexcept(std::is_nothrow_destructible_v<value_type>) -> void override
+        {
+            if constexpr ( is_pointer_stable )
+            {
+                for ( index_type const index : indices ) { remove( index ); }
+            }
+            else
             {
-                packed_[element_pos]          = packed_[last_element_pos];
-                elements_[element_pos]        = std::move( elements_[last_element_pos] );
-                sparse_[packed_[element_pos]] = encode_sparse_index( element_pos );
+                if ( indices.size( ) * compaction_ratio < packed_.size( ) )
+                {
+                    for ( index_type const index : indices ) { remove( index ); }
+                    return;
+                }
+
+                // 1. clear the slot of every removed element, a cleared slot marks its element for removal
+                bool removed{ false };
+                for ( index_type const index : indices )
+                {
+                    if ( has( index ) )
+                    {
+                        sparse_.reset( key_of( index ) );
+                        removed = true;
+                    }
+                }
+                if ( not removed ) { return; }
+
+                // 2. slide the kept elements down over the removed ones
+                std::size_t kept{ 0U };
+                for ( std::size_t pos = 0U; pos < packed_.size( ); ++pos )
+                {
+                    std::size_t const key = key_of( packed_[pos] );
+                    if ( sparse_[key] == null_element ) { continue; }
+
+                    if ( kept != pos )
+                    {
+                        packed_[kept]   = packed_[pos];
+                        elements_[kept] = std::move( elements_[pos] );
+                        sparse_.assign( key, encode_sparse_index( static_cast<index_type>( kept ) ) );
+                        if constexpr ( tracks_ticks )
+                        {
+                            ticks_.added[kept]   = ticks_.added[pos];
+                            ticks_.changed[kept] = ticks_.changed[pos];
+                        }
+                    }
+                    ++kept;
+                }
+                packed_.erase( packed_.begin( ) + static_cast<std::ptrdiff_t>( kept ), packed_.end( ) );
+                elements_.resize( kept );
+                if constexpr ( tracks_ticks )
+                {
+                    ticks_.added.resize( kept );
+                    ticks_.changed.resize( kept );
+                }
             }
+        }
 
-            // 3. remove last element and clear sparse mapping
-            sparse_[index] = null_element;
-            packed_.pop_back( );
-            elements_.pop_back( );
+
+        /**
+         * @brief Swaps two elements in the packed storage, keeping the sparse mapping consistent.
+         *
+         * Lets the owner impose an order on the packed arrays (e.g. keep a subset packed at the front).
+         * References and spans to the two elements observe the swap.
+         *
+         * @complexity O(1)
+         * @param lhs Packed position of the first element
+         * @param rhs Packed position of the second element
+         * @note Pointer-stable sets never move their elements, the call asserts and does nothing.
+         */
+        auto swap_positions( std::size_t const lhs, std::size_t const rhs ) -> void override
+        {
+            assert( lhs < packed_.size( ) && rhs < packed_.size( ) && "sparse_set::swap_positions: position out of range!" );
+            assert( not is_pointer_stable && "sparse_set::swap_positions: the set is pointer-stable!" );
+            if ( is_pointer_stable || lhs == rhs ) { return; }
+
+            std::swap( packed_[lhs], packed_[rhs] );
+            std::swap( elements_[lhs], elements_[rhs] );
+            if constexpr ( tracks_ticks )
+            {
+                std::swap( ticks_.added[lhs], ticks_.added[rhs] );
+                std::swap( ticks_.changed[lhs], ticks_.changed[rhs] );
+            }
+            sparse_.assign( key_of( packed_[lhs] ), encode_sparse_index( static_cast<index_type>( lhs ) ) );
+            sparse_.assign( key_of( packed_[rhs] ), encode_sparse_index( static_cast<index_type>( rhs ) ) );
         }
 
 
         /**
-         * Clears the sparse set, removing all elements.
+         * @brief Sorts the packed storage in place by element, keeping the sparse mapping consistent.
+         *
+         * The sort is stable. A nearly sorted set, with a few adjacent pairs out of order (e.g. a handful of keys
+         * changed since the last sort), is fixed with an insertion sort. Any other order is stable-sorted by
+         * position and the permutation is applied in a single pass. Sorting is not a change: the change ticks
+         * move with their elements.
+         *
+         * @code
+         * frames.sort( []( pelt_frame const& lhs, pelt_frame const& rhs ) { return lhs.z_index < rhs.z_index; } );
+         * @endcode
+         *
+         * @complexity O(n) if sorted, O(n + m) if nearly sorted where m is the number of moves, O(n log n) otherwise
+         * @param compare Strict weak ordering over the elements
+         * @note References and spans to the elements and packed positions obtained before the call are invalidated.
+         */
+        template <typename TCompare> requires std::strict_weak_order<TCompare&, value_type const&, value_type const&>
+        auto sort( TCompare compare ) -> void requires ( not is_pointer_stable )
+        {
+            std::size_t descents{ 0U };
+            for ( std::size_t pos = 1U; pos < packed_.size( ) && descents <= insertion_sort_descents; ++pos )
+            {
+                if ( compare( elements_[pos], elements_[pos - 1U] ) ) { ++descents; }
+            }
+
+            if ( descents == 0U ) { return; }
+            if ( descents <= insertion_sort_descents )
+            {
+                insertion_sort( compare );
+                return;
+            }
+
+            // a temporary of the call, kept off resource_: a monotonic level arena would never get it back
+            std::vector<std::size_t> order( packed_.size( ) );
+            std::iota( order.begin( ), order.end( ), std::size_t{ 0U } );
+            std::ranges::stable_sort(
+                order, [this, &compare]( std::size_t const lhs, std::size_t const rhs )
+                {
+                    return compare( elements_[lhs], elements_[rhs] );
+                } );
+            apply_order( order );
+        }
+
+
+        /**
+         * @brief Reorders the packed storage so that the indices shared with @other come first, in @other's
+         * packed order. The remaining indices follow in unspecified order.
+         *
+         * Aligning two sets makes their co-iteration sequential, the shared elements sit at the same positions in
+         * both.
+         *
+         * @complexity O(m) where m is the size of @other
+         * @param other The set whose order to follow
+         * @note References and spans to the elements and packed positions obtained before the call are invalidated.
+         */
+        auto sort_as( base_sparse_set<TIndex> const& other ) -> void requires ( not is_pointer_stable )
+        {
+            std::size_t next{ 0U };
+            for ( index_type const index : other.packed( ) )
+            {
+                if ( std::size_t const pos = position( index ); pos != npos )
+                {
+                    swap_positions( pos, next++ );
+                }
+            }
+        }
+
+
+        /**
+         * Clears the sparse set, removing all elements and releasing every sparse page.
          * @complexity O(n)
          */
         auto clear( ) noexcept(std::is_nothrow_destructible_v<value_type>) -> void override
@@ -243,6 +870,55 @@ namespace rst
             sparse_.clear( );
             packed_.clear( );
             elements_.clear( );
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added.clear( );
+                ticks_.changed.clear( );
+            }
+            if constexpr ( is_pointer_stable ) { free_.clear( ); }
+        }
+
+
+        /**
+         * @brief Gives back the memory the set holds past its size: the spare capacity of the packed arrays and the
+         * sparse pages no index maps through anymore.
+         *
+         * Sets keep their peak capacity otherwise, e.g. after a wave of enemies has been destroyed. Pointer-stable
+         * sets drop their trailing tombstones and release the pages past their last element, every element left
+         * keeps its address. Tombstones between elements stay, for the next insertions to reuse.
+         *
+         * @complexity O(n + p) where n is the size of the set and p the number of sparse pages, the arrays are
+         * reallocated to their size
+         * @note Invalidates the spans and references obtained before the call, except for pointer-stable elements.
+         */
+        auto shrink_to_fit( ) -> void override
+        {
+            if constexpr ( is_pointer_stable )
+            {
+                std::size_t size = packed_.size( );
+                while ( size > 0U && packed_[size - 1U] == tombstone ) { --size; }
+                if ( size != packed_.size( ) )
+                {
+                    std::erase_if( free_, [size]( index_type const pos ) { return pos >= size; } );
+                    packed_.resize( size );
+                    elements_.truncate( size );
+                    if constexpr ( tracks_ticks )
+                    {
+                        ticks_.added.resize( size );
+                        ticks_.changed.resize( size );
+                    }
+                }
+            }
+
+            sparse_.shrink_to_fit( );
+            packed_.shrink_to_fit( );
+            elements_.shrink_to_fit( );
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added.shrink_to_fit( );
+                ticks_.changed.shrink_to_fit( );
+            }
+            if constexpr ( is_pointer_stable ) { free_.shrink_to_fit( ); }
         }
 
 
@@ -257,7 +933,7 @@ namespace rst
             {
                 return std::unexpected{ data_structure_error::index_not_found };
             }
-            return elements_[decode_sparse_index( sparse_[index] )];
+            return elements_[decode_sparse_index( sparse_[key_of( index )] )];
         }
 
 
@@ -272,7 +948,7 @@ namespace rst
             {
                 return std::unexpected{ data_structure_error::index_not_found };
             }
-            return elements_[decode_sparse_index( sparse_[index] )];
+            return elements_[decode_sparse_index( sparse_[key_of( index )] )];
         }
 
 
@@ -286,7 +962,7 @@ namespace rst
         [[nodiscard]] auto unsafe_get( index_type index ) noexcept -> reference_type
         {
             assert( has( index ) && "sparse_set::get: index doesn't have an element!" );
-            return elements_[decode_sparse_index( sparse_[index] )];
+            return elements_[decode_sparse_index( sparse_[key_of( index )] )];
         }
 
 
@@ -300,7 +976,67 @@ namespace rst
         [[nodiscard]] auto unsafe_get( index_type index ) const noexcept -> const_reference_type
         {
             assert( has(index ) && "sparse_set::get: index doesn't have an element!" );
-            return elements_[decode_sparse_index( sparse_[index] )];
+            return elements_[decode_sparse_index( sparse_[key_of( index )] )];
+        }
+
+
+        // +--------------------------------+
+        // | CHANGE TICKS                   |
+        // +--------------------------------+
+        /**
+         * @brief Sets the clock new and changed elements are stamped with.
+         *
+         * Inserting an element stamps its added and changed ticks with the clock's current value, replacing it or
+         * accessing it through touch stamps its changed tick. Until a clock is bound every stamp is 0.
+         *
+         * @param clock The clock to read, must outlive the set
+         */
+        auto bind_clock( std::atomic<tick_type> const& clock ) noexcept -> void requires tracks_ticks
+        {
+            ticks_.clock_ptr = &clock;
+        }
+
+
+        /**
+         * @complexity O(1)
+         * @param index The index of the element to get, must be in the set
+         * @return A mutable reference to the element at the given index, whose changed tick is stamped now
+         */
+        [[nodiscard]] auto touch( index_type index ) noexcept -> reference_type requires tracks_ticks
+        {
+            assert( has( index ) && "sparse_set::touch: index doesn't have an element!" );
+            index_type const pos = decode_sparse_index( sparse_[key_of( index )] );
+            ticks_.changed[pos]  = ticks_.now( );
+            return elements_[pos];
+        }
+
+
+        /**
+         * @brief Stamps the changed tick of @count elements from packed position @first, for writes through data( ).
+         * @complexity O(count)
+         */
+        auto touch_range( std::size_t const first, std::size_t const count ) noexcept -> void requires tracks_ticks
+        {
+            assert( first + count <= packed_.size( ) && "sparse_set::touch_range: range out of bounds!" );
+            std::fill_n( ticks_.changed.begin( ) + static_cast<std::ptrdiff_t>( first ), count, ticks_.now( ) );
+        }
+
+
+        /**
+         * @return The tick each element was inserted at, in packed order
+         */
+        [[nodiscard]] auto added_ticks( ) const noexcept -> std::span<tick_type const> requires tracks_ticks
+        {
+            return ticks_.added;
+        }
+
+
+        /**
+         * @return The tick each element was last inserted, replaced or touched at, in packed order
+         */
+        [[nodiscard]] auto changed_ticks( ) const noexcept -> std::span<tick_type const> requires tracks_ticks
+        {
+            return ticks_.changed;
         }
 
 
@@ -322,8 +1058,12 @@ namespace rst
          * in the same order as their corresponding indices in the packed array.
          * 
          * @return A mutable span over the elements array
+         * @note Tag sets have no elements array, see tag_span. Pointer-stable sets have one per page, see page_data
          */
-        [[nodiscard]] auto data( ) noexcept -> std::span<value_type> { return elements_; }
+        [[nodiscard]] auto data( ) noexcept -> std::span<value_type> requires ( not is_tag_set && not is_pointer_stable )
+        {
+            return elements_;
+        }
 
 
         /**
@@ -333,12 +1073,82 @@ namespace rst
          * are stored in the same order as their corresponding indices in the packed array.
          * 
          * @return A const span over the elements array
+         * @note Tag sets have no elements array, see tag_span. Pointer-stable sets have one per page, see page_data
+         */
+        [[nodiscard]] auto data( ) const noexcept -> std::span<value_type const> requires ( not is_tag_set && not is_pointer_stable )
+        {
+            return elements_;
+        }
+
+
+        /**
+         * @brief Stands in for a run of data( ) in pointer-stable sets, whose elements are stored one page at a time.
+         *
+         * Positions past the end of the set and tombstones hold default constructed elements.
+         *
+         * @param first Packed position of the first element
+         * @param count Length of the span, the run must not cross a page boundary (see page_end)
+         * @return A mutable span over @count elements from packed position @first
+         */
+        [[nodiscard]] auto page_data( std::size_t const first, std::size_t const count ) noexcept -> std::span<value_type>
+            requires is_pointer_stable
+        {
+            return elements_.page_data( first, count );
+        }
+
+
+        /**
+         * @param pos A packed position
+         * @return The first packed position past the page holding @pos
+         */
+        [[nodiscard]] static constexpr auto page_end( std::size_t const pos ) noexcept -> std::size_t requires is_pointer_stable
+        {
+            return ( pos / page_size + 1U ) * page_size;
+        }
+
+
+        /**
+         * @brief Stands in for a run of data( ) in tag sets, which store no elements.
+         *
+         * Every instance of an empty type is alike, so the span views a shared buffer instead of the set. Writes
+         * through it have nothing to change.
+         *
+         * @param count Length of the span, at most tag_span_capacity
+         * @return A span of @count elements
+         */
+        [[nodiscard]] static auto tag_span( std::size_t const count ) noexcept -> std::span<value_type> requires is_tag_set
+        {
+            static std::array<value_type, tag_span_capacity> buffer{};
+            assert( count <= tag_span_capacity && "sparse_set::tag_span: span too long!" );
+            return std::span{ buffer }.first( count );
+        }
+
+
+        /**
+         * Longest span tag_span hands out.
          */
-        [[nodiscard]] auto data( ) const noexcept -> std::span<value_type const> { return elements_; }
+        static constexpr std::size_t tag_span_capacity{ 1024U };
 
 
         /**
-         * @return Returns the number of filled elements in the sparse set
+         * Elements per page of pointer-stable sets.
+         */
+        static constexpr std::size_t page_size = []
+        {
+            if constexpr ( is_pointer_stable )
+            {
+                return internal::sparse_stable_elements<value_type>::page_size;
+            }
+            else
+            {
+                return std::size_t{ 0U };
+            }
+        }( );
+
+
+        /**
+         * @return Returns the number of filled elements in the sparse set. Pointer-stable sets count their
+         * tombstones as well, as the packed array spans them
          */
         [[nodiscard]] auto size( ) const noexcept -> std::size_t override { return packed_.size( ); }
 
@@ -354,28 +1164,271 @@ namespace rst
           */
         [[nodiscard]] auto empty( ) const noexcept -> bool override { return packed_.empty( ); }
 
-    private:
-        std::vector<sparse_index_type> sparse_; // TIndex -> packed index mapping
-        std::vector<index_type> packed_;        // packed array of indices
-        std::vector<value_type> elements_;      // TElements in same order as packed
 
         /**
-         * Ensures that the sparse array can accommodate the given index, resizing if necessary and filling new slots
-         * with null_element.
-         * @param index
-         */
-        auto ensure_size( index_type index ) noexcept(std::is_nothrow_constructible_v<TIndex>) -> void
+          * @return Bytes owned by the sparse pages, the packed indices, the elements and the free list
+          */
+        [[nodiscard]] auto memory_usage( ) const noexcept -> std::size_t override
+        {
+            std::size_t bytes = sparse_.memory_usage( ) + packed_.capacity( ) * sizeof( index_type ) +
+                                elements_.capacity( ) * sizeof( value_type );
+            if constexpr ( tracks_ticks )
+            {
+                bytes += ( ticks_.added.capacity( ) + ticks_.changed.capacity( ) ) * sizeof( tick_type );
+            }
+            if constexpr ( is_pointer_stable ) { bytes += free_.capacity( ) * sizeof( index_type ); }
+            return bytes;
+        }
+
+
+        /**
+          * @return What the set allocated from its upstream resource so far. Unlike memory_usage, includes what the
+          * arrays gave back while growing, which an arena cannot reuse
+          */
+        [[nodiscard]] auto allocation_stats( ) const noexcept -> memory::allocation_stats override
+        {
+            return resource_.stats( );
+        }
+
+
+        /**
+          * @brief Type-erased stand-in for data( ), page_data and tag_span, for callers that only know the base set.
+          *
+          * @param first A packed position
+          * @return The elements from packed position @first up to the end of the set, or of its page in
+          * pointer-stable sets. Tombstones are part of the run
+          */
+        [[nodiscard]] auto erased_elements( std::size_t const first ) noexcept -> erased_run override
+        {
+            if ( first >= packed_.size( ) ) { return { }; }
+
+            std::size_t const length = packed_.size( ) - first;
+            if constexpr ( is_tag_set )
+            {
+                return { reinterpret_cast<std::byte*>( tag_span( 1U ).data( ) ), 0U, length };
+            }
+            else if constexpr ( is_pointer_stable )
+            {
+                std::size_t const run = std::min( length, page_end( first ) - first );
+                return { reinterpret_cast<std::byte*>( page_data( first, run ).data( ) ), sizeof( value_type ), run };
+            }
+            else
+            {
+                return { reinterpret_cast<std::byte*>( elements_.data( ) + first ), sizeof( value_type ), length };
+            }
+        }
+
+
+        /**
+          * @return The resource the set allocates from
+          */
+        [[nodiscard]] auto upstream_resource( ) const noexcept -> std::pmr::memory_resource*
+        {
+            return resource_.upstream( );
+        }
+
+    private:
+        // batch removals compact the set once they remove at least 1 / compaction_ratio of it
+        static constexpr std::size_t compaction_ratio{ 8U };
+        // sort falls back to a full sort past this many adjacent pairs out of order
+        static constexpr std::size_t insertion_sort_descents{ 16U };
+
+        // counts what the arrays below allocate, declared first to outlive them
+        memory::counting_resource resource_;
+
+        paged_sparse_array<sparse_index_type> sparse_; // TIndex -> packed index mapping, paged
+        std::pmr::vector<index_type> packed_;          // packed array of indices
+
+        // TElements in same order as packed, paged if pointer-stable, nothing for tags
+        [[no_unique_address]] std::conditional_t<
+            is_tag_set, internal::sparse_tag_elements<value_type>,
+            std::conditional_t<is_pointer_stable, internal::sparse_stable_elements<value_type>, std::pmr::vector<value_type>>> elements_;
+
+        [[no_unique_address]] std::conditional_t<tracks_ticks, internal::sparse_tick_columns, internal::sparse_no_ticks> ticks_;
+
+        // tombstoned packed positions of pointer-stable sets, the last one is reused first
+        [[no_unique_address]] std::conditional_t<is_pointer_stable, std::pmr::vector<index_type>, internal::sparse_no_free_list> free_;
+
+
+        // maps the indices appended from @first on to their positions
+        auto link_from( std::size_t const first ) -> void
+        {
+            for ( std::size_t pos = first; pos < packed_.size( ); ++pos )
+            {
+                assert( sparse_[key_of( packed_[pos] )] == null_element && "sparse_set::append: index already in the set!" );
+                sparse_.assign( key_of( packed_[pos] ), encode_sparse_index( static_cast<index_type>( pos ) ) );
+            }
+        }
+
+
+        // maps @index to a new element, in the most recent tombstone if there is one or at the back of the set
+        template <typename... TArgs>
+        auto emplace_new( index_type const index, TArgs&&... args ) -> reference_type
         {
-            if ( index >= sparse_.size( ) )
+            if constexpr ( is_pointer_stable )
             {
-                sparse_.resize( index + 1U, null_element );
+                assert( index != tombstone && "sparse_set::insert: the tombstone index is reserved!" );
+                if ( not free_.empty( ) )
+                {
+                    index_type const pos = free_.back( );
+                    free_.pop_back( );
+                    sparse_.assign( key_of( index ), encode_sparse_index( pos ) );
+                    packed_[pos] = index;
+                    stamp_ticks( pos );
+                    return elements_.assign( pos, std::forward<TArgs>( args )... );
+                }
             }
+
+            sparse_.assign( key_of( index ), encode_sparse_index( static_cast<index_type>( packed_.size( ) ) ) );
+            packed_.emplace_back( index );
+            push_ticks( );
+            return elements_.emplace_back( std::forward<TArgs>( args )... );
+        }
+
+
+        // stamps the element just placed in a reused position
+        auto stamp_ticks( std::size_t const pos ) -> void
+        {
+            if constexpr ( tracks_ticks )
+            {
+                tick_type const now = ticks_.now( );
+                ticks_.added[pos]   = now;
+                ticks_.changed[pos] = now;
+            }
+        }
+
+
+        // stamps the element just appended to the packed array
+        auto push_ticks( ) -> void
+        {
+            if constexpr ( tracks_ticks )
+            {
+                tick_type const now = ticks_.now( );
+                ticks_.added.push_back( now );
+                ticks_.changed.push_back( now );
+            }
+        }
+
+
+        // +--------------------------------+
+        // | SORTING                        |
+        // +--------------------------------+
+        // one element in flight while the others are shifted, with its index and ticks
+        struct sort_slot
+        {
+            value_type element;
+            index_type index;
+            [[no_unique_address]] std::conditional_t<tracks_ticks, std::pair<tick_type, tick_type>, internal::sparse_no_ticks> ticks;
+        };
+
+
+        [[nodiscard]] auto take_slot( std::size_t const pos ) noexcept -> sort_slot
+        {
+            if constexpr ( tracks_ticks )
+            {
+                return sort_slot{ std::move( elements_[pos] ), packed_[pos], { ticks_.added[pos], ticks_.changed[pos] } };
+            }
+            else
+            {
+                return sort_slot{ std::move( elements_[pos] ), packed_[pos], { } };
+            }
+        }
+
+
+        auto put_slot( sort_slot& slot, std::size_t const pos ) noexcept -> void
+        {
+            elements_[pos] = std::move( slot.element );
+            packed_[pos]   = slot.index;
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added[pos]   = slot.ticks.first;
+                ticks_.changed[pos] = slot.ticks.second;
+            }
+        }
+
+
+        // moves the packed index, element and ticks at @from to @to, the sparse mapping is fixed by remap_from
+        auto move_position( std::size_t const from, std::size_t const to ) noexcept -> void
+        {
+            elements_[to] = std::move( elements_[from] );
+            packed_[to]   = packed_[from];
+            if constexpr ( tracks_ticks )
+            {
+                ticks_.added[to]   = ticks_.added[from];
+                ticks_.changed[to] = ticks_.changed[from];
+            }
+        }
+
+
+        auto remap_from( std::size_t const first ) noexcept -> void
+        {
+            for ( std::size_t pos = first; pos < packed_.size( ); ++pos )
+            {
+                sparse_.assign( key_of( packed_[pos] ), encode_sparse_index( static_cast<index_type>( pos ) ) );
+            }
+        }
+
+
+        template <typename TCompare>
+        auto insertion_sort( TCompare& compare ) -> void
+        {
+            std::size_t first_moved{ packed_.size( ) };
+            for ( std::size_t pos = 1U; pos < packed_.size( ); ++pos )
+            {
+                if ( not compare( elements_[pos], elements_[pos - 1U] ) ) { continue; }
+
+                sort_slot slot   = take_slot( pos );
+                std::size_t hole = pos;
+                do
+                {
+                    move_position( hole - 1U, hole );
+                    --hole;
+                }
+                while ( hole > 0U && compare( slot.element, elements_[hole - 1U] ) );
+                put_slot( slot, hole );
+                first_moved = std::min( first_moved, hole );
+            }
+            remap_from( first_moved );
+        }
+
+
+        // @order[pos] is the current position of the element that belongs at pos, consumed by the call
+        auto apply_order( std::span<std::size_t> const order ) noexcept -> void
+        {
+            // follow each cycle of the permutation, every element is moved once
+            for ( std::size_t start = 0U; start < order.size( ); ++start )
+            {
+                if ( order[start] == start ) { continue; }
+
+                sort_slot slot   = take_slot( start );
+                std::size_t hole = start;
+                while ( order[hole] != start )
+                {
+                    std::size_t const next = order[hole];
+                    move_position( next, hole );
+                    order[hole] = hole;
+                    hole        = next;
+                }
+                put_slot( slot, hole );
+                order[hole] = hole;
+            }
+            remap_from( 0U );
         }
 
 
         // +--------------------------------+
         // | TRANSCODING                    |
         // +--------------------------------+
+        /**
+         * @param index Index as seen by the caller
+         * @return The sparse slot addressed by @index
+         */
+        [[nodiscard]] static constexpr auto key_of( index_type index ) noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>( TTraits::to_index( index ) );
+        }
+
+
         /**
          * @param index Packed index to encode
          * @return The positional index for the packed to sparse conversion, encoded to avoid null_element (0U)
@@ -438,7 +1491,7 @@ namespace rst
       *       - Modifying element values in-place is always safe
       *
       * @tparam TIndex The entity index type (typically uint32_t)
-      * @tparam TElements The element types to intersect
+      * @tparam TElements The element types to intersect, one set per type
       *
       * @complexity Iterator operations are O(k) where k is the number of component types
       */
@@ -447,6 +1500,10 @@ namespace rst
     {
         using set_array_type = std::array<base_sparse_set<TIndex> const*, sizeof...( TElements )>;
 
+        // one set reference per element type, whatever traits the concrete set uses
+        template <typename>
+        using set_ref_type = base_sparse_set<TIndex> const&;
+
     public:
         // +--------------------------------+
         // | FACTORIES                      |
@@ -456,9 +1513,9 @@ namespace rst
          * @param sets
          * @return
          */
-        static auto begin( sparse_set<TElements, TIndex>&... sets ) noexcept -> sparse_intersection_iterator
+        static auto begin( set_ref_type<TElements>... sets ) noexcept -> sparse_intersection_iterator
         {
-            auto& smallest_set = *meta::find_smallest<base_sparse_set<TIndex>>( sets... );
+            auto const& smallest_set = *meta::find_smallest<base_sparse_set<TIndex> const>( sets... );
             return sparse_intersection_iterator{ 0U, smallest_set, sets... };
         }
 
@@ -471,7 +1528,7 @@ namespace rst
          */
         static auto begin(
             base_sparse_set<TIndex> const& pivot,
-            sparse_set<TElements, TIndex>&... sets ) noexcept -> sparse_intersection_iterator
+            set_ref_type<TElements>... sets ) noexcept -> sparse_intersection_iterator
         {
             return sparse_intersection_iterator{ 0U, pivot, sets... };
         }
@@ -482,9 +1539,9 @@ namespace rst
          * @param sets
          * @return
          */
-        static auto end( sparse_set<TElements, TIndex>&... sets ) noexcept -> sparse_intersection_iterator
+        static auto end( set_ref_type<TElements>... sets ) noexcept -> sparse_intersection_iterator
         {
-            auto& smallest_set = *meta::find_smallest<base_sparse_set<TIndex>>( sets... );
+            auto const& smallest_set = *meta::find_smallest<base_sparse_set<TIndex> const>( sets... );
             return sparse_intersection_iterator{ static_cast<TIndex>( smallest_set.size( ) ), smallest_set, sets... };
         }
 
@@ -497,7 +1554,7 @@ namespace rst
          */
         static auto end(
             base_sparse_set<TIndex> const& pivot,
-            sparse_set<TElements, TIndex>&... sets ) noexcept -> sparse_intersection_iterator
+            set_ref_type<TElements>... sets ) noexcept -> sparse_intersection_iterator
         {
             return sparse_intersection_iterator{ static_cast<TIndex>( pivot.size( ) ), pivot, sets... };
         }
@@ -562,7 +1619,7 @@ namespace rst
          * @param pos
          */
         explicit sparse_intersection_iterator(
-            TIndex const pos, base_sparse_set<TIndex> const& pivot, sparse_set<TElements, TIndex>&... sets ) noexcept
+            TIndex const pos, base_sparse_set<TIndex> const& pivot, set_ref_type<TElements>... sets ) noexcept
             : pivot_set_ref_{ pivot }
             , sets_{ &sets... }
             , packed_pos_{ std::clamp( pos, TIndex{ 0U }, static_cast<TIndex>( pivot_set_ref_.size( ) ) ) }
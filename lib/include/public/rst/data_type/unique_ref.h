@@ -89,6 +89,13 @@ namespace rst
          */
         explicit unique_ref( value_type* ptr ) : ptr_{ ptr } { }
 
+        /**
+         * @brief Constructs a unique_ref taking ownership of the given pointer, to be destroyed by @deleter.
+         * @param ptr Raw pointer to take ownership of
+         * @param deleter Deleter to destroy @ptr with, e.g. one that knows which memory resource it came from
+         */
+        unique_ref( value_type* ptr, TDeleter deleter ) : ptr_{ ptr }, deleter_{ std::move( deleter ) } { }
+
 
         /**
          * @brief Destructor that automatically deletes the managed object.
@@ -114,13 +121,13 @@ namespace rst
 
 
         /**
-         * @brief Move constructor that transfers ownership.
+         * @brief Move constructor that transfers ownership, along with the deleter.
          * @param other The unique_ref to move from
          */
-        unique_ref( unique_ref&& other ) noexcept : ptr_{ other.release( ) } { }
+        unique_ref( unique_ref&& other ) noexcept : ptr_{ other.release( ) }, deleter_{ std::move( other.deleter_ ) } { }
 
         /**
-         * @brief Move assignment operator that transfers ownership.
+         * @brief Move assignment operator that transfers ownership, along with the deleter.
          * @param other The unique_ref to move from
          * @return Reference to this unique_ref
          */
@@ -129,6 +136,7 @@ namespace rst
             if ( this != &other )
             {
                 reset( other.release( ) );
+                deleter_ = std::move( other.deleter_ );
             }
             return *this;
         }
@@ -0,0 +1,177 @@
+#ifndef RST_WORKER_POOL_H
+#define RST_WORKER_POOL_H
+
+#include <rst/pch.h>
+
+
+namespace rst::thread
+{
+    class worker_pool;
+
+
+    /**
+     * @brief Tracks a set of tasks submitted to a worker_pool, so that a thread can wait for all of them.
+     *
+     * A task_group must outlive every task submitted with it, and cannot be reused until wait() returned.
+     */
+    class task_group final
+    {
+        friend class worker_pool;
+
+    public:
+        task_group( ) noexcept  = default;
+        ~task_group( ) noexcept = default;
+
+        task_group( task_group const& )                        = delete;
+        task_group( task_group&& ) noexcept                    = delete;
+        auto operator=( task_group const& ) -> task_group&     = delete;
+        auto operator=( task_group&& ) noexcept -> task_group& = delete;
+
+        /**
+         * @return True once every task submitted with this group has run.
+         */
+        [[nodiscard]] auto done( ) const noexcept -> bool { return pending_.load( std::memory_order_acquire ) == 0U; }
+
+    private:
+        std::atomic<std::size_t> pending_{ 0U };
+    };
+
+
+    /**
+     * @brief A reusable, work-stealing pool of worker threads.
+     *
+     * Every worker owns a task queue: it pops its own tasks newest first and, when empty, steals the oldest task
+     * of another queue. Tasks submitted from outside the pool land in a shared queue that every worker steals
+     * from. Threads are spawned once, at construction, and sleep while there is nothing to run.
+     *
+     * A thread waiting on a task_group runs pending tasks instead of blocking, so waiting from inside a task is
+     * safe and the calling thread counts as one more worker. A pool built with a thread count of one has no
+     * workers at all: everything runs on the waiting thread, in submission order, which makes it a deterministic
+     * single-threaded fallback.
+     *
+     * @code
+     * thread::worker_pool pool{ 8U };
+     *
+     * // split a range into chunks of 1024, the calling thread helps and returns when all chunks ran
+     * pool.parallel_for( values.size( ), 1024U, [&]( std::size_t first, std::size_t last ) {
+     *     for ( std::size_t i = first; i < last; ++i ) { values[i] *= 2.f; }
+     * } );
+     *
+     * // or submit heterogeneous tasks and wait for them
+     * thread::task_group group{};
+     * pool.submit( group, [&] { update_ai( ); } );
+     * pool.submit( group, [&] { update_particles( ); } );
+     * pool.wait( group );
+     * @endcode
+     *
+     * @note Tasks must not throw.
+     */
+    class worker_pool final
+    {
+    public:
+        using task_type = std::function<void( )>;
+
+        /**
+         * @brief Spawns thread_count - 1 workers, the thread that waits being the last one.
+         * @param thread_count Total number of threads running tasks, defaults to the hardware concurrency
+         */
+        explicit worker_pool( std::size_t thread_count = default_thread_count( ) );
+        ~worker_pool( ) noexcept;
+
+        worker_pool( worker_pool const& )                        = delete;
+        worker_pool( worker_pool&& ) noexcept                    = delete;
+        auto operator=( worker_pool const& ) -> worker_pool&     = delete;
+        auto operator=( worker_pool&& ) noexcept -> worker_pool& = delete;
+
+        /**
+         * @return The hardware concurrency, or 1 if unknown
+         */
+        [[nodiscard]] static auto default_thread_count( ) noexcept -> std::size_t;
+
+        /**
+         * @return Number of threads running tasks, waiting thread included
+         */
+        [[nodiscard]] auto thread_count( ) const noexcept -> std::size_t;
+
+        /**
+         * @return Index of the calling thread in the pool: 1 to thread_count - 1 for a worker, 0 for any other thread
+         */
+        [[nodiscard]] auto thread_index( ) const noexcept -> std::size_t;
+
+        /**
+         * @brief Queues a task. From a worker it goes to that worker's queue, otherwise to the shared one.
+         * @complexity O(1)
+         * @param group The group to account the task in
+         * @param task The task to run
+         */
+        auto submit( task_group& group, task_type task ) -> void;
+
+        /**
+         * @brief Runs pending tasks until every task of @group has completed.
+         * @param group The group to wait for
+         */
+        auto wait( task_group& group ) -> void;
+
+        /**
+         * @brief Splits [0, count) into chunks of @chunk_size and runs @body on each of them, returning once all ran.
+         *
+         * @complexity O(count / chunk_size) tasks
+         * @param count Size of the range
+         * @param chunk_size Elements per chunk, the last chunk may be shorter
+         * @param body Called as body( first, last ) for every chunk, concurrently
+         */
+        template <std::invocable<std::size_t, std::size_t> TBody>
+        auto parallel_for( std::size_t const count, std::size_t const chunk_size, TBody&& body ) -> void
+        {
+            std::size_t const step = std::max( chunk_size, std::size_t{ 1U } );
+            if ( count <= step || workers_.empty( ) )
+            {
+                for ( std::size_t first = 0U; first < count; first += step )
+                {
+                    body( first, std::min( first + step, count ) );
+                }
+                return;
+            }
+
+            task_group group{};
+            for ( std::size_t first = 0U; first < count; first += step )
+            {
+                submit( group, [&body, first, last = std::min( first + step, count )] { body( first, last ); } );
+            }
+            wait( group );
+        }
+
+    private:
+        struct task_entry final
+        {
+            task_type task;
+            task_group* group;
+        };
+
+
+        struct alignas( 64 ) task_queue final
+        {
+            std::mutex mutex{};
+            std::deque<task_entry> tasks{};
+        };
+
+
+        // queue 0 is shared by threads outside the pool, queue i + 1 belongs to worker i
+        std::vector<std::unique_ptr<task_queue>> queues_{};
+        std::vector<std::thread> workers_{};
+
+        std::mutex sleep_mutex_{};
+        std::condition_variable wake_cv_{};
+        std::atomic<std::size_t> queued_{ 0U };
+        bool stopping_{ false };
+
+
+        auto worker_loop( std::size_t queue_index ) -> void;
+        [[nodiscard]] auto try_run_one( std::size_t queue_index ) -> bool;
+        [[nodiscard]] auto try_pop( std::size_t queue_index, bool newest ) -> std::optional<task_entry>;
+        [[nodiscard]] auto current_queue_index( ) const noexcept -> std::size_t;
+    };
+}
+
+
+#endif //!RST_WORKER_POOL_H
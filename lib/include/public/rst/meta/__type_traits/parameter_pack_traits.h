@@ -33,6 +33,19 @@ namespace rst::meta
     inline constexpr std::size_t index_of_v = index_of<TTarget, TPack...>::value;
 
 
+    // +--------------------------------+
+    // | TYPE LIST                      |
+    // +--------------------------------+
+    /**
+     * An inert holder for a pack of types, to pass packs around and pattern match them.
+     */
+    template <typename... Ts>
+    struct type_list final
+    {
+        static constexpr std::size_t size{ sizeof...( Ts ) };
+    };
+
+
     // +--------------------------------+
     // | FIRST ELEMENT                  |
     // +--------------------------------+
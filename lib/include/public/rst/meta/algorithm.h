@@ -57,6 +57,18 @@ namespace rst::meta
     {
         return std::apply( []( TRanges&... unpacked ) { return meta::find_smallest<TBase, TRanges...>( unpacked... ); }, ranges );
     }
+
+
+    template <typename TBase, std::ranges::forward_range TPointers>
+        requires std::convertible_to<std::ranges::range_value_t<TPointers>, TBase*>
+    [[nodiscard]] constexpr auto find_smallest( TPointers const& ranges ) noexcept -> TBase*
+    {
+        if ( std::ranges::empty( ranges ) )
+        {
+            return nullptr;
+        }
+        return *std::ranges::min_element( ranges, []( auto const* a, auto const* b ) { return a->size( ) < b->size( ); } );
+    }
 }
 
 
@@ -0,0 +1,76 @@
+#ifndef RST_META_TYPE_INDEX_H
+#define RST_META_TYPE_INDEX_H
+
+#include <rst/pch.h>
+
+
+namespace rst::meta
+{
+    // +--------------------------------+
+    // | SEQUENTIAL INDEX TYPE          |
+    // +--------------------------------+
+    using sequential_index_type = uint32_t;
+
+
+    // +--------------------------------+
+    // | TYPE SEQUENCE                  |
+    // +--------------------------------+
+    /**
+     * @brief Hands out dense, sequential indices to types, one sequence per family.
+     *
+     * The first type queried in a family gets index 0, the next one 1, and so on. Indices are stable for the
+     * lifetime of the process (not across runs or builds, use type_hash_v for that), so they are meant to
+     * address flat arrays instead of hashing a type on every lookup.
+     *
+     * @code
+     * struct component_family;
+     *
+     * auto const position_index = type_sequence<component_family>::index_of<position>( ); // 0
+     * auto const velocity_index = type_sequence<component_family>::index_of<velocity>( ); // 1
+     * assert( type_sequence<component_family>::index_of<position const>( ) == position_index );
+     * @endcode
+     *
+     * @note Thread safe. The first query of a type costs an atomic increment, later ones a guarded static load.
+     * @note Indices are per binary image: types queried both inside and outside a shared library would get two indices.
+     *
+     * @tparam TFamily Tag type separating independent sequences
+     */
+    template <typename TFamily>
+    class type_sequence final
+    {
+    public:
+        /**
+         * @complexity O(1)
+         * @tparam T The type to index, cv-qualifiers are ignored
+         * @return The index of T in this family
+         */
+        template <typename T>
+        [[nodiscard]] static auto index_of( ) noexcept -> sequential_index_type
+        {
+            return index_of_impl<std::remove_cv_t<T>>( );
+        }
+
+
+        /**
+         * @return Number of types indexed so far in this family
+         */
+        [[nodiscard]] static auto size( ) noexcept -> sequential_index_type
+        {
+            return next_index_.load( std::memory_order_relaxed );
+        }
+
+    private:
+        static inline std::atomic<sequential_index_type> next_index_{ 0U };
+
+
+        template <typename T>
+        [[nodiscard]] static auto index_of_impl( ) noexcept -> sequential_index_type
+        {
+            static sequential_index_type const index = next_index_.fetch_add( 1U, std::memory_order_relaxed );
+            return index;
+        }
+    };
+}
+
+
+#endif //!RST_META_TYPE_INDEX_H
@@ -0,0 +1,190 @@
+#include <rst/__core/__ecs/archetype.h>
+
+
+namespace rst::ecs::detail
+{
+    namespace
+    {
+        [[nodiscard]] constexpr auto align_up( std::size_t const value, std::size_t const alignment ) noexcept -> std::size_t
+        {
+            return ( value + alignment - 1U ) / alignment * alignment;
+        }
+    }
+
+
+    archetype::archetype( std::span<component_layout const> const layouts, std::pmr::memory_resource* const resource )
+        : resource_ptr_{ resource }
+        , layouts_{ layouts.begin( ), layouts.end( ) }
+    {
+        std::size_t row_bytes = sizeof( entity_type );
+        std::size_t padding   = cache_line_alignment_;
+        for ( std::size_t i = 0U; i < layouts_.size( ); ++i )
+        {
+            if ( layouts_[i].size == 0U ) { continue; }
+            columns_.push_back( i );
+            row_bytes += layouts_[i].size;
+            padding += std::max<std::size_t>( layouts_[i].alignment, cache_line_alignment_ );
+            chunk_alignment_ = std::max<std::size_t>( layouts_[i].alignment, chunk_alignment_ );
+        }
+
+        // as many rows as fit once every column is aligned, at least one
+        chunk_capacity_ = chunk_bytes > padding ? std::max<std::size_t>( ( chunk_bytes - padding ) / row_bytes, 1U ) : 1U;
+
+        std::size_t offset = align_up( chunk_capacity_ * sizeof( entity_type ), cache_line_alignment_ );
+        for ( std::size_t const index : columns_ )
+        {
+            offset = align_up( offset, std::max<std::size_t>( layouts_[index].alignment, cache_line_alignment_ ) );
+            column_offsets_.push_back( offset );
+            offset += chunk_capacity_ * layouts_[index].size;
+        }
+        chunk_size_ = align_up( std::max( offset, chunk_alignment_ ), chunk_alignment_ );
+    }
+
+
+    archetype::~archetype( ) noexcept
+    {
+        for ( std::byte* const chunk : chunks_ )
+        {
+            resource_ptr_->deallocate( chunk, chunk_size_, chunk_alignment_ );
+        }
+    }
+
+
+    auto archetype::append( entity_type const entity ) -> std::size_t
+    {
+        if ( size_ == chunks_.size( ) * chunk_capacity_ )
+        {
+            chunks_.reserve( chunks_.size( ) + 1U );
+            chunks_.push_back( static_cast<std::byte*>( resource_ptr_->allocate( chunk_size_, chunk_alignment_ ) ) );
+        }
+        entities_of( size_ / chunk_capacity_ )[size_ % chunk_capacity_] = entity;
+        return size_++;
+    }
+
+
+    auto archetype::copy_row( archetype const& source, std::size_t const source_row, std::size_t const row ) noexcept -> void
+    {
+        // both column lists are sorted by id, walk them together
+        std::size_t source_column{ 0U };
+        for ( std::size_t column = 0U; column < columns_.size( ); ++column )
+        {
+            meta::sequential_index_type const id = layouts_[columns_[column]].id;
+            while ( source_column < source.columns_.size( ) && source.layouts_[source.columns_[source_column]].id < id )
+            {
+                ++source_column;
+            }
+            if ( source_column == source.columns_.size( ) ) { return; }
+            if ( source.layouts_[source.columns_[source_column]].id == id )
+            {
+                std::memcpy( component( row, column ), source.component( source_row, source_column ), layouts_[columns_[column]].size );
+            }
+        }
+    }
+
+
+    auto archetype::erase( std::size_t const row ) noexcept -> entity_type
+    {
+        std::size_t const last = --size_;
+        if ( row == last ) { return null_entity; }
+
+        for ( std::size_t column = 0U; column < columns_.size( ); ++column )
+        {
+            std::memcpy( component( row, column ), component( last, column ), layouts_[columns_[column]].size );
+        }
+        entity_type const moved = entity( last );
+        entities_of( row / chunk_capacity_ )[row % chunk_capacity_] = moved;
+        return moved;
+    }
+
+
+    auto archetype::clear( ) noexcept -> void
+    {
+        size_ = 0U;
+    }
+
+
+    auto archetype::includes( meta::sequential_index_type const id ) const noexcept -> bool
+    {
+        return std::ranges::binary_search( layouts_, id, { }, &component_layout::id );
+    }
+
+
+    auto archetype::includes( std::span<meta::sequential_index_type const> const ids ) const noexcept -> bool
+    {
+        return std::ranges::includes( layouts_, ids, { }, &component_layout::id );
+    }
+
+
+    auto archetype::column_of( meta::sequential_index_type const id ) const noexcept -> std::size_t
+    {
+        auto const it = std::ranges::lower_bound( layouts_, id, { }, &component_layout::id );
+        if ( it == layouts_.end( ) || it->id != id || it->size == 0U )
+        {
+            return npos;
+        }
+        auto const index = static_cast<std::size_t>( it - layouts_.begin( ) );
+        return static_cast<std::size_t>( std::ranges::lower_bound( columns_, index ) - columns_.begin( ) );
+    }
+
+
+    auto archetype::component( std::size_t const row, std::size_t const column ) const noexcept -> std::byte*
+    {
+        return chunk_column( row / chunk_capacity_, column ) + row % chunk_capacity_ * layouts_[columns_[column]].size;
+    }
+
+
+    auto archetype::chunk_column( std::size_t const chunk, std::size_t const column ) const noexcept -> std::byte*
+    {
+        return chunks_[chunk] + column_offsets_[column];
+    }
+
+
+    auto archetype::chunk_entities( std::size_t const chunk ) const noexcept -> std::span<entity_type const>
+    {
+        std::size_t const first = chunk * chunk_capacity_;
+        return { entities_of( chunk ), std::min( chunk_capacity_, size_ - first ) };
+    }
+
+
+    auto archetype::entity( std::size_t const row ) const noexcept -> entity_type
+    {
+        return entities_of( row / chunk_capacity_ )[row % chunk_capacity_];
+    }
+
+
+    auto archetype::edge_of( meta::sequential_index_type const id ) -> edge&
+    {
+        if ( id >= edges_.size( ) ) { edges_.resize( id + 1U ); }
+        return edges_[id];
+    }
+
+
+    auto archetype::layouts( ) const noexcept -> std::span<component_layout const>
+    {
+        return layouts_;
+    }
+
+
+    auto archetype::chunk_count( ) const noexcept -> std::size_t
+    {
+        return ( size_ + chunk_capacity_ - 1U ) / chunk_capacity_;
+    }
+
+
+    auto archetype::chunk_capacity( ) const noexcept -> std::size_t
+    {
+        return chunk_capacity_;
+    }
+
+
+    auto archetype::size( ) const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+
+    auto archetype::entities_of( std::size_t const chunk ) const noexcept -> entity_type*
+    {
+        return reinterpret_cast<entity_type*>( chunks_[chunk] );
+    }
+}
@@ -0,0 +1,128 @@
+#include <rst/__core/__ecs/archetype_registry.h>
+
+
+namespace rst::ecs
+{
+    archetype_registry::archetype_registry( std::pmr::memory_resource* const resource )
+        : resource_ptr_{ resource }
+        , root_{ { }, resource }
+        , locations_{ resource }
+        , entity_alloc_{ resource }
+    {
+        entity_alloc_.on_destruction.bind( this, &archetype_registry::destroy_entity );
+        entity_alloc_.on_batch_destruction.bind( this, &archetype_registry::destroy_entities );
+        entity_alloc_.on_clear.bind( this, &archetype_registry::clear_entities );
+    }
+
+
+    auto archetype_registry::archetype_count( ) const noexcept -> std::size_t
+    {
+        return tables_.size( );
+    }
+
+
+    auto archetype_registry::resource( ) const noexcept -> std::pmr::memory_resource*
+    {
+        return resource_ptr_;
+    }
+
+
+    auto archetype_registry::location_of( entity_type const entity ) -> entity_location&
+    {
+        entity_traits::index_type const index = entity_traits::to_index( entity );
+        if ( index >= locations_.size( ) )
+        {
+            locations_.resize( index + 1U );
+        }
+        return locations_[index];
+    }
+
+
+    auto archetype_registry::move_entity(
+        entity_type const entity, entity_location& location, detail::archetype& target ) -> void
+    {
+        detail::archetype* const source = location.table;
+        std::size_t const source_row     = location.row;
+
+        // the root table holds no rows, the entity just has no location while it has no component
+        if ( &target == &root_ )
+        {
+            location = { };
+        }
+        else
+        {
+            std::size_t const row = target.append( entity );
+            if ( source != nullptr ) { target.copy_row( *source, source_row, row ); }
+            location = { &target, row };
+        }
+
+        if ( source != nullptr )
+        {
+            if ( entity_type const moved = source->erase( source_row ); moved != null_entity )
+            {
+                locations_[entity_traits::to_index( moved )].row = source_row;
+            }
+        }
+    }
+
+
+    auto archetype_registry::table_with(
+        detail::archetype const& source, detail::component_layout const added ) -> detail::archetype&
+    {
+        std::vector<detail::component_layout> layouts{ source.layouts( ).begin( ), source.layouts( ).end( ) };
+        layouts.insert( std::ranges::upper_bound( layouts, added.id, { }, &detail::component_layout::id ), added );
+        return find_or_create_table( layouts );
+    }
+
+
+    auto archetype_registry::table_without(
+        detail::archetype const& source, meta::sequential_index_type const removed ) -> detail::archetype&
+    {
+        std::vector<detail::component_layout> layouts{ source.layouts( ).begin( ), source.layouts( ).end( ) };
+        std::erase_if( layouts, [removed]( detail::component_layout const& layout ) { return layout.id == removed; } );
+        return layouts.empty( ) ? root_ : find_or_create_table( layouts );
+    }
+
+
+    auto archetype_registry::find_or_create_table( std::span<detail::component_layout const> const layouts ) -> detail::archetype&
+    {
+        // only reached when an edge is followed for the first time
+        for ( auto& table : tables_ )
+        {
+            if ( std::ranges::equal( table->layouts( ), layouts, { }, &detail::component_layout::id, &detail::component_layout::id ) )
+            {
+                return table.value( );
+            }
+        }
+        return tables_.emplace_back( ref::make_unique<detail::archetype>( layouts, resource_ptr_ ) ).value( );
+    }
+
+
+    auto archetype_registry::destroy_entity( entity_type const entity ) -> void
+    {
+        entity_traits::index_type const index = entity_traits::to_index( entity );
+        if ( index < locations_.size( ) && locations_[index].table != nullptr )
+        {
+            move_entity( entity, locations_[index], root_ );
+        }
+    }
+
+
+    auto archetype_registry::destroy_entities( std::span<entity_type const> const entities ) -> void
+    {
+        for ( entity_type const entity : entities )
+        {
+            destroy_entity( entity );
+        }
+    }
+
+
+    auto archetype_registry::clear_entities( ) -> void
+    {
+        for ( auto& table : tables_ )
+        {
+            table->clear( );
+        }
+        locations_.clear( );
+    }
+}
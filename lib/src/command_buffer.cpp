@@ -0,0 +1,105 @@
+#include <rst/__core/__ecs/command_buffer.h>
+
+
+namespace rst::ecs
+{
+    auto command_buffer::create( ) noexcept -> deferred_entity
+    {
+        return deferred_entity{ created_count_++ };
+    }
+
+
+    auto command_buffer::destroy( entity_type const entity ) -> void
+    {
+        destroyed_.push_back( { entity, false } );
+    }
+
+
+    auto command_buffer::destroy( deferred_entity const entity ) -> void
+    {
+        destroyed_.push_back( { entity.id, true } );
+    }
+
+
+    auto command_buffer::playback( registry& registry ) -> void
+    {
+        // 1. create the deferred entities, then swap every deferred target for its real handle
+        std::vector<entity_type> created( created_count_ );
+        std::ranges::generate( created, [&registry] { return registry.entity_alloc( ).create( ); } );
+
+        auto const resolve = [&created]( target& entity )
+        {
+            if ( entity.deferred )
+            {
+                entity = { created[entity.value], false };
+            }
+        };
+        for ( command& cmd : commands_ ) { resolve( cmd.entity ); }
+        for ( target& entity : destroyed_ ) { resolve( entity ); }
+
+        // 2. group the commands per pool, entities ascending inside a pool. The sort is stable so that commands on
+        // the same component of the same entity keep their recording order
+        std::ranges::stable_sort(
+            commands_, {}, []( command const& cmd ) { return std::pair{ cmd.component_id, cmd.entity.value }; } );
+
+        // 3. one pass per pool
+        std::span<command const> remaining{ commands_ };
+        while ( not remaining.empty( ) )
+        {
+            auto const run_end = std::ranges::find_if_not(
+                remaining, [id = remaining.front( ).component_id]( command const& cmd ) { return cmd.component_id == id; } );
+            auto const run_size = static_cast<std::size_t>( run_end - remaining.begin( ) );
+
+            remaining.front( ).playback( registry, remaining.first( run_size ), arena_ );
+            remaining = remaining.subspan( run_size );
+        }
+
+        // 4. destructions last, stale and duplicate handles are ignored by the allocator
+        std::ranges::sort( destroyed_, {}, &target::value );
+        for ( target const& entity : destroyed_ )
+        {
+            registry.entity_alloc( ).destroy( entity.value );
+        }
+
+        clear( );
+    }
+
+
+    auto command_buffer::append( command_buffer& other ) -> void
+    {
+        auto const payload_base = static_cast<uint32_t>( arena_.size( ) );
+        auto const rebase       = [created = created_count_]( target entity )
+        {
+            if ( entity.deferred ) { entity.value += created; }
+            return entity;
+        };
+
+        commands_.reserve( commands_.size( ) + other.commands_.size( ) );
+        for ( command cmd : other.commands_ )
+        {
+            cmd.entity = rebase( cmd.entity );
+            cmd.payload_offset += payload_base;
+            commands_.push_back( cmd );
+        }
+        std::ranges::transform( other.destroyed_, std::back_inserter( destroyed_ ), rebase );
+        arena_.insert( arena_.end( ), other.arena_.begin( ), other.arena_.end( ) );
+        created_count_ += other.created_count_;
+
+        other.clear( );
+    }
+
+
+    auto command_buffer::clear( ) noexcept -> void
+    {
+        commands_.clear( );
+        destroyed_.clear( );
+        arena_.clear( );
+        created_count_ = 0U;
+    }
+
+
+    auto command_buffer::empty( ) const noexcept -> bool
+    {
+        return commands_.empty( ) && destroyed_.empty( ) && created_count_ == 0U;
+    }
+}
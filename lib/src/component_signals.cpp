@@ -0,0 +1,10 @@
+#include <rst/__core/__ecs/component_signals.h>
+
+
+namespace rst::ecs
+{
+    auto component_signals::broadcast_emplace( registry& registry, entity_type const entity, bool const replaced ) const -> void
+    {
+        ( replaced ? on_replace : on_construct ).broadcast( registry, entity );
+    }
+}
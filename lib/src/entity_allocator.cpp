@@ -3,27 +3,144 @@
 
 namespace rst::ecs
 {
-    entity_allocator::entity_allocator( ) { }
+    entity_allocator::entity_allocator( ) : entity_allocator{ std::pmr::get_default_resource( ) } { }
+
+
+    entity_allocator::entity_allocator( std::pmr::memory_resource* const resource )
+        : slots_{ resource }
+        , free_handles_{ resource }
+        , created_batch_{ resource }
+        , destroyed_batch_{ resource }
+    {
+        // index 0 is reserved, null_entity never becomes alive
+        slots_.emplace_back( null_entity );
+    }
 
 
     auto entity_allocator::create( ) -> entity_type
     {
-        entity_type const entity = token_gen_.generate( );
+        entity_type entity;
+        if ( not free_handles_.empty( ) )
+        {
+            entity = free_handles_.back( );
+            free_handles_.pop_back( );
+        }
+        else if ( slots_.size( ) <= entity_traits::max_index )
+        {
+            entity = entity_traits::combine( static_cast<entity_traits::index_type>( slots_.size( ) ), 0U );
+            slots_.emplace_back( null_entity );
+        }
+        else
+        {
+            return null_entity;
+        }
+
+        slots_[entity_traits::to_index( entity )] = entity;
         on_creation.broadcast( entity );
         return entity;
     }
 
 
-    // ReSharper disable once CppMemberFunctionMayBeConst
+    auto entity_allocator::create( std::size_t const count ) -> std::span<entity_type const>
+    {
+        created_batch_.clear( );
+        created_batch_.reserve( count );
+
+        // 1. recycled handles first, most recently freed first like create( )...
+        std::size_t const recycled = std::min( count, free_handles_.size( ) );
+        created_batch_.insert( created_batch_.end( ), free_handles_.rbegin( ), free_handles_.rbegin( ) + recycled );
+        free_handles_.resize( free_handles_.size( ) - recycled );
+
+        // 2. ... then fresh indices, as many as the index space allows
+        std::size_t const fresh = std::min( count - recycled, entity_traits::max_index + 1U - slots_.size( ) );
+        for ( std::size_t i = 0U; i < fresh; ++i )
+        {
+            created_batch_.push_back( entity_traits::combine( static_cast<entity_traits::index_type>( slots_.size( ) + i ), 0U ) );
+        }
+        slots_.resize( slots_.size( ) + fresh, null_entity );
+
+        for ( entity_type const entity : created_batch_ )
+        {
+            slots_[entity_traits::to_index( entity )] = entity;
+        }
+        if ( not created_batch_.empty( ) )
+        {
+            on_batch_creation.broadcast( created_batch_ );
+        }
+        return created_batch_;
+    }
+
+
     auto entity_allocator::destroy( entity_type const entity ) -> void
     {
+        if ( not alive( entity ) ) { return; }
+
+        // listeners still see the live handle, the version is bumped afterward
         on_destruction.broadcast( entity );
+        release( entity_traits::to_index( entity ) );
+    }
+
+
+    auto entity_allocator::destroy( std::span<entity_type const> const entities ) -> void
+    {
+        // live handles only, each once: the slot of a picked handle is cleared so that its duplicates fail the
+        // alive check, then restored for the listeners
+        destroyed_batch_.clear( );
+        for ( entity_type const entity : entities )
+        {
+            if ( alive( entity ) )
+            {
+                destroyed_batch_.push_back( entity );
+                slots_[entity_traits::to_index( entity )] = null_entity;
+            }
+        }
+        for ( entity_type const entity : destroyed_batch_ )
+        {
+            slots_[entity_traits::to_index( entity )] = entity;
+        }
+
+        if ( destroyed_batch_.empty( ) ) { return; }
+
+        // listeners still see the live handles, the versions are bumped afterward
+        on_batch_destruction.broadcast( destroyed_batch_ );
+        for ( entity_type const entity : destroyed_batch_ )
+        {
+            release( entity_traits::to_index( entity ) );
+        }
     }
 
 
     auto entity_allocator::clear( ) -> void
     {
-        token_gen_.reset( );
+        // listeners still see the live handles, the versions are bumped afterward
         on_clear.broadcast( );
+        for ( entity_traits::index_type index = 1U; index < slots_.size( ); ++index )
+        {
+            if ( slots_[index] != null_entity )
+            {
+                release( index );
+            }
+        }
+    }
+
+
+    auto entity_allocator::alive( entity_type const entity ) const noexcept -> bool
+    {
+        entity_traits::index_type const index = entity_traits::to_index( entity );
+        return entity != null_entity && index < slots_.size( ) && slots_[index] == entity;
+    }
+
+
+    auto entity_allocator::alive_count( ) const noexcept -> std::size_t
+    {
+        return slots_.size( ) - 1U - free_handles_.size( );
+    }
+
+
+    auto entity_allocator::release( entity_traits::index_type const index ) -> void
+    {
+        entity_traits::version_type const version = entity_traits::to_version( slots_[index] );
+        free_handles_.emplace_back( entity_traits::combine( index, entity_traits::next_version( version ) ) );
+        slots_[index] = null_entity;
     }
 }
@@ -0,0 +1,206 @@
+#include <rst/__core/__system/frame_profiler.h>
+
+#ifdef RST_ENABLE_PROFILING
+
+#include <rst/diagnostic.h>
+
+#include <fstream>
+
+
+namespace rst
+{
+    namespace
+    {
+        // small, stable per-thread ids for the trace, in order of first use
+        auto current_thread_id( ) noexcept -> uint32_t
+        {
+            static std::atomic<uint32_t> next_id{ 0U };
+            static thread_local uint32_t const id = next_id.fetch_add( 1U, std::memory_order_relaxed );
+            return id;
+        }
+
+
+        auto category_name( profile_category const category ) noexcept -> std::string_view
+        {
+            switch ( category )
+            {
+                case profile_category::frame: return "frame";
+                case profile_category::hook: return "hook";
+                case profile_category::system: return "system";
+                case profile_category::user: return "user";
+            }
+            return "unknown";
+        }
+
+
+        auto write_json_string( std::ostream& os, std::string_view const text ) -> void
+        {
+            os << '"';
+            for ( char const c : text )
+            {
+                if ( c == '"' || c == '\\' ) { os << '\\' << c; }
+                else if ( static_cast<unsigned char>( c ) < 0x20U ) { os << ' '; }
+                else { os << c; }
+            }
+            os << '"';
+        }
+    }
+
+
+    frame_profiler::frame_profiler( std::size_t const window, std::size_t const trace_capacity )
+        : window_{ std::max( window, std::size_t{ 1U } ) }
+        , trace_capacity_{ std::max( trace_capacity, std::size_t{ 1U } ) }
+    {
+        trace_.reserve( trace_capacity_ );
+    }
+
+
+    auto frame_profiler::record(
+        std::string_view const name, profile_category const category, clock_type::time_point const begin,
+        clock_type::time_point const end ) -> void
+    {
+        auto const duration = std::chrono::duration_cast<std::chrono::nanoseconds>( end - begin );
+
+        std::lock_guard lock{ mutex_ };
+
+        auto it = scopes_.find( name );
+        if ( it == scopes_.end( ) )
+        {
+            it = scopes_.emplace( std::string{ name }, scope_samples{ category } ).first;
+            it->second.ring.reserve( window_ );
+        }
+
+        // 1. rolling window, the ring is written in call order and wraps once full
+        scope_samples& samples = it->second;
+        if ( samples.ring.size( ) < window_ ) { samples.ring.push_back( duration ); }
+        else { samples.ring[samples.calls % window_] = duration; }
+        ++samples.calls;
+
+        // 2. trace, oldest events are overwritten once full
+        trace_event const event{ &it->first, category, current_thread_id( ), begin, duration };
+        if ( trace_.size( ) < trace_capacity_ ) { trace_.push_back( event ); }
+        else { trace_[trace_next_] = event; }
+        trace_next_ = ( trace_next_ + 1U ) % trace_capacity_;
+    }
+
+
+    auto frame_profiler::stats( std::string_view const name ) const -> std::optional<profile_stats>
+    {
+        std::lock_guard lock{ mutex_ };
+
+        auto const it = scopes_.find( name );
+        if ( it == scopes_.end( ) || it->second.ring.empty( ) )
+        {
+            return std::nullopt;
+        }
+        return compute_stats( it->second );
+    }
+
+
+    auto frame_profiler::all_stats( ) const -> std::vector<std::pair<std::string, profile_stats>>
+    {
+        std::lock_guard lock{ mutex_ };
+
+        std::vector<std::pair<std::string, profile_stats>> result{};
+        result.reserve( scopes_.size( ) );
+        for ( auto const& [name, samples] : scopes_ )
+        {
+            if ( not samples.ring.empty( ) ) { result.emplace_back( name, compute_stats( samples ) ); }
+        }
+        return result;
+    }
+
+
+    auto frame_profiler::set_window( std::size_t const window ) -> void
+    {
+        std::lock_guard lock{ mutex_ };
+
+        window_ = std::max( window, std::size_t{ 1U } );
+        for ( auto& [_, samples] : scopes_ )
+        {
+            samples.ring.clear( );
+            samples.ring.reserve( window_ );
+            samples.calls = 0U;
+        }
+    }
+
+
+    auto frame_profiler::window( ) const -> std::size_t
+    {
+        std::lock_guard lock{ mutex_ };
+        return window_;
+    }
+
+
+    auto frame_profiler::write_chrome_trace( std::filesystem::path const& path ) const -> bool
+    {
+        std::ofstream file{ path, std::ios::out | std::ios::trunc };
+        if ( not file.is_open( ) )
+        {
+            alert( "frame_profiler: could not open '{}' for writing!", path.string( ) );
+            return false;
+        }
+
+        std::lock_guard lock{ mutex_ };
+
+        // complete events ("ph":"X"), timestamps and durations in microseconds since the profiler's creation
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first{ true };
+        for ( std::size_t i = 0U; i < trace_.size( ); ++i )
+        {
+            // start from the oldest event once the ring wrapped
+            trace_event const& event = trace_[trace_.size( ) < trace_capacity_ ? i : ( trace_next_ + i ) % trace_capacity_];
+
+            auto const begin_us = std::chrono::duration<double, std::micro>( event.begin - epoch_ ).count( );
+            auto const duration_us = std::chrono::duration<double, std::micro>( event.duration ).count( );
+
+            file << ( first ? "\n" : ",\n" ) << "{\"name\":";
+            write_json_string( file, *event.name_ptr );
+            file << ",\"cat\":\"" << category_name( event.category ) << "\",\"ph\":\"X\",\"pid\":0"
+                 << ",\"tid\":" << event.thread << ",\"ts\":" << begin_us << ",\"dur\":" << duration_us << '}';
+            first = false;
+        }
+        file << "\n]}\n";
+
+        if ( not file.good( ) )
+        {
+            alert( "frame_profiler: failed writing the trace to '{}'!", path.string( ) );
+            return false;
+        }
+        return true;
+    }
+
+
+    auto frame_profiler::clear( ) -> void
+    {
+        std::lock_guard lock{ mutex_ };
+
+        trace_.clear( );
+        trace_next_ = 0U;
+        scopes_.clear( );
+    }
+
+
+    auto frame_profiler::compute_stats( scope_samples const& samples ) -> profile_stats
+    {
+        std::vector<std::chrono::nanoseconds> sorted{ samples.ring };
+        std::ranges::sort( sorted );
+
+        std::chrono::nanoseconds total{ 0 };
+        for ( auto const sample : sorted ) { total += sample; }
+
+        // nearest-rank percentile
+        std::size_t const p99_rank = ( sorted.size( ) * 99U + 99U ) / 100U;
+
+        return profile_stats{
+            .category = samples.category,
+            .calls = samples.calls,
+            .last = samples.ring[( samples.calls - 1U ) % samples.ring.size( )],
+            .min = sorted.front( ),
+            .avg = total / static_cast<std::chrono::nanoseconds::rep>( sorted.size( ) ),
+            .p99 = sorted[p99_rank - 1U]
+        };
+    }
+}
+
+#endif //RST_ENABLE_PROFILING
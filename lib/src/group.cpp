@@ -0,0 +1,84 @@
+#include <rst/__core/__ecs/group.h>
+
+
+namespace rst::ecs::detail
+{
+    group_handler::group_handler( std::vector<base_reg_pool_type*> pools, std::vector<meta::sequential_index_type> component_ids )
+        : pools_{ std::move( pools ) }
+        , component_ids_{ std::move( component_ids ) }
+    {
+        std::ranges::sort( component_ids_ );
+        regroup( );
+    }
+
+
+    auto group_handler::on_emplace( entity_type const entity ) -> void
+    {
+        if ( not std::ranges::all_of( pools_, [entity]( auto const* pool ) { return pool->has( entity ); } ) )
+        {
+            return;
+        }
+        if ( pools_.front( )->position( entity ) < size_ )
+        {
+            return; // already grouped, e.g. a replace
+        }
+
+        for ( base_reg_pool_type* pool : pools_ )
+        {
+            pool->swap_positions( pool->position( entity ), size_ );
+        }
+        ++size_;
+    }
+
+
+    auto group_handler::on_remove( entity_type const entity ) -> void
+    {
+        // npos is never below size_, so entities missing from the pool fall through as well
+        if ( pools_.front( )->position( entity ) >= size_ )
+        {
+            return;
+        }
+
+        --size_;
+        for ( base_reg_pool_type* pool : pools_ )
+        {
+            pool->swap_positions( pool->position( entity ), size_ );
+        }
+    }
+
+
+    auto group_handler::on_clear( ) noexcept -> void
+    {
+        size_ = 0U;
+    }
+
+
+    auto group_handler::regroup( ) -> void
+    {
+        size_ = 0U;
+
+        // pull in the entities that already own every component, walking the smallest pool. Swaps only ever
+        // bring an already visited entity to the current position, so a single pass is enough
+        base_reg_pool_type const& smallest = **std::ranges::min_element(
+            pools_, []( auto const* lhs, auto const* rhs ) { return lhs->size( ) < rhs->size( ); } );
+
+        for ( std::size_t pos = 0U; pos < smallest.size( ); ++pos )
+        {
+            on_emplace( smallest.packed( )[pos] );
+        }
+    }
+
+
+    auto group_handler::owns( std::span<meta::sequential_index_type const> const component_ids ) const -> bool
+    {
+        std::vector<meta::sequential_index_type> sorted{ component_ids.begin( ), component_ids.end( ) };
+        std::ranges::sort( sorted );
+        return sorted == component_ids_;
+    }
+
+
+    auto group_handler::size( ) const noexcept -> std::size_t
+    {
+        return size_;
+    }
+}
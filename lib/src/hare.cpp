@@ -26,6 +26,11 @@ namespace rst
         // RENDERER.init( g_window_ptr );
         // RESOURCE_MANAGER.init( data_path );
         service_locator_.register_renderer_service<service::sdl_renderer_service>( window_title, viewport_ );
+        service_locator_.register_worker_pool( );
+        service_locator_.register_frame_scratch( );
+#ifdef RST_ENABLE_PROFILING
+        service_locator_.register_profiler( );
+#endif
         scheduler_.register_system<system::renderer_system>( system_timing::render );
     }
 
@@ -44,6 +49,12 @@ namespace rst
     }
 
 
+    auto hare::staging( ) noexcept -> ecs::staging_area&
+    {
+        return staging_;
+    }
+
+
     auto hare::service_locator( ) noexcept -> rst::service_locator&
     {
         return service_locator_;
@@ -82,11 +93,21 @@ namespace rst
 
     auto hare::run_one_frame( ) -> void
     {
+#ifdef RST_ENABLE_PROFILING
+        profile_scope const frame_scope{ service_locator_.profiler( ), "frame", profile_category::frame };
+#endif
+
         // +--------------------------------+
         // | TIME CALCULATIONS ( ticking )  |
         // +--------------------------------+
         GAME_TIME.tick( );
 
+        // +--------------------------------+
+        // | STAGED ENTITIES                |
+        // +--------------------------------+
+        // what other threads staged since the last frame, before any system iterates the registry
+        staging_.merge( registry_ );
+
         // +--------------------------------+
         // | EARLY TICK & INPUT             |
         // +--------------------------------+
@@ -131,6 +152,9 @@ namespace rst
         // SCENE_POOL.cleanup( );
         RESOURCE_MANAGER.unload_unused_resources( );
 
+        // whatever the frame allocated from the scratch arenas is gone by now
+        service_locator_.reset_frame_scratch( );
+
         // +--------------------------------+
         // | SLEEPING                       |
         // +--------------------------------+
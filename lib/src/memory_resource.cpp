@@ -0,0 +1,115 @@
+#include <rst/data_type/memory_resource.h>
+
+
+namespace rst::memory
+{
+    // +--------------------------------+
+    // | COUNTING RESOURCE              |
+    // +--------------------------------+
+    counting_resource::counting_resource( std::pmr::memory_resource* const upstream ) noexcept
+        : upstream_ptr_{ upstream } { }
+
+
+    auto counting_resource::upstream( ) const noexcept -> std::pmr::memory_resource*
+    {
+        return upstream_ptr_;
+    }
+
+
+    auto counting_resource::stats( ) const noexcept -> allocation_stats
+    {
+        return stats_;
+    }
+
+
+    auto counting_resource::do_allocate( std::size_t const bytes, std::size_t const alignment ) -> void*
+    {
+        void* const ptr = upstream_ptr_->allocate( bytes, alignment );
+        stats_.bytes_in_use += bytes;
+        stats_.peak_bytes = std::max( stats_.peak_bytes, stats_.bytes_in_use );
+        ++stats_.allocations;
+        return ptr;
+    }
+
+
+    auto counting_resource::do_deallocate( void* const ptr, std::size_t const bytes, std::size_t const alignment ) -> void
+    {
+        upstream_ptr_->deallocate( ptr, bytes, alignment );
+        stats_.bytes_in_use -= bytes;
+        ++stats_.deallocations;
+    }
+
+
+    auto counting_resource::do_is_equal( std::pmr::memory_resource const& other ) const noexcept -> bool
+    {
+        return this == &other;
+    }
+
+
+    // +--------------------------------+
+    // | MONOTONIC ARENA                |
+    // +--------------------------------+
+    monotonic_arena::monotonic_arena( std::size_t const initial_bytes, std::pmr::memory_resource* const upstream )
+        : upstream_ptr_{ upstream }
+        , initial_bytes_{ std::max( initial_bytes, std::size_t{ 1U } ) }
+        , initial_block_ptr_{ upstream->allocate( initial_bytes_, alignof( std::max_align_t ) ) }
+        , overflow_{ upstream }
+        , buffer_{ initial_block_ptr_, initial_bytes_, &overflow_ } { }
+
+
+    monotonic_arena::~monotonic_arena( ) noexcept
+    {
+        buffer_.release( );
+        upstream_ptr_->deallocate( initial_block_ptr_, initial_bytes_, alignof( std::max_align_t ) );
+    }
+
+
+    auto monotonic_arena::reset( ) noexcept -> void
+    {
+        // the buffer resource starts over from the initial block once released
+        buffer_.release( );
+        stats_.bytes_in_use = 0U;
+    }
+
+
+    auto monotonic_arena::stats( ) const noexcept -> allocation_stats
+    {
+        return stats_;
+    }
+
+
+    auto monotonic_arena::initial_capacity( ) const noexcept -> std::size_t
+    {
+        return initial_bytes_;
+    }
+
+
+    auto monotonic_arena::overflow_bytes( ) const noexcept -> std::size_t
+    {
+        return overflow_.stats( ).bytes_in_use;
+    }
+
+
+    auto monotonic_arena::do_allocate( std::size_t const bytes, std::size_t const alignment ) -> void*
+    {
+        void* const ptr = buffer_.allocate( bytes, alignment );
+        stats_.bytes_in_use += bytes;
+        stats_.peak_bytes = std::max( stats_.peak_bytes, stats_.bytes_in_use );
+        ++stats_.allocations;
+        return ptr;
+    }
+
+
+    auto monotonic_arena::do_deallocate( void* const ptr, std::size_t const bytes, std::size_t const alignment ) -> void
+    {
+        // a no-op for the buffer, counted so that the stats show how much a non-monotonic resource would give back
+        buffer_.deallocate( ptr, bytes, alignment );
+        ++stats_.deallocations;
+    }
+
+
+    auto monotonic_arena::do_is_equal( std::pmr::memory_resource const& other ) const noexcept -> bool
+    {
+        return this == &other;
+    }
+}
@@ -0,0 +1,57 @@
+#include <rst/__core/__ecs/prefab.h>
+
+
+namespace rst::ecs
+{
+    auto prefab::instantiate( registry& registry, std::size_t const count ) const -> std::span<entity_type const>
+    {
+        std::span<entity_type const> const entities = registry.entity_alloc( ).create( count );
+        for ( component_entry const& entry : components_ )
+        {
+            entry.instantiate( registry, entities, arena_.data( ) + entry.payload_offset );
+        }
+        return entities;
+    }
+
+
+    auto prefab::instantiate( registry& registry ) const -> entity_type
+    {
+        entity_type const entity = registry.entity_alloc( ).create( );
+        if ( entity == null_entity )
+        {
+            return null_entity;
+        }
+
+        for ( component_entry const& entry : components_ )
+        {
+            entry.instantiate( registry, std::span{ &entity, 1U }, arena_.data( ) + entry.payload_offset );
+        }
+        return entity;
+    }
+
+
+    auto prefab::clear( ) noexcept -> void
+    {
+        components_.clear( );
+        arena_.clear( );
+    }
+
+
+    auto prefab::size( ) const noexcept -> std::size_t
+    {
+        return components_.size( );
+    }
+
+
+    auto prefab::empty( ) const noexcept -> bool
+    {
+        return components_.empty( );
+    }
+
+
+    auto prefab::find( meta::sequential_index_type const component_id ) noexcept -> component_entry*
+    {
+        auto const it = std::ranges::find( components_, component_id, &component_entry::component_id );
+        return it != components_.end( ) ? &*it : nullptr;
+    }
+}
@@ -14,18 +14,32 @@ namespace rst::system
     {
         auto& renderer = locator.renderer_service( );
 
-        auto view = registry.view<transform, pelt_frame const>( );
+        // 1. keep the frames in z order, between two frames only a few of them move and the sort is linear. A group
+        // owning the frames keeps its own order, and a sort that fails to allocate leaves them as they were: the
+        // dispatch then sorts the requests itself
+        if ( not registry.is_owned<pelt_frame>( ) )
+        {
+            try
+            {
+                registry.sort<pelt_frame>( []( pelt_frame const& lhs, pelt_frame const& rhs ) { return lhs.z_index < rhs.z_index; } );
+            }
+            catch ( std::bad_alloc const& ) { }
+        }
 
-        // 1. queue renders
-        for ( auto [_, transform, frame] : view.each( ) )
+        // 2. queue renders walking the frames themselves, so the requests come in their order. A view of both
+        // components would be led by the smaller pool
+        auto transforms = registry.view<transform>( );
+        auto frames     = registry.view<pelt_frame const>( );
+        for ( auto [entity, frame] : frames.each( ) )
         {
-            if ( frame.texture == nullptr ) { continue; }
+            if ( frame.texture == nullptr || not registry.has<transform>( entity ) ) { continue; }
 
+            transform& world_transform = *transforms.unsafe_get<transform>( entity );
             renderer.z_order( frame.z_index );
-            renderer.render( *frame.texture, transform.world( ).location( ), frame.src_rect );
+            renderer.render( *frame.texture, world_transform.world( ).location( ), frame.src_rect );
         }
 
-        // 2. dispatch render
+        // 3. dispatch render
         renderer.render_dispatch( );
     }
 }
@@ -0,0 +1,146 @@
+#include <rst/__core/__ecs/runtime_view.h>
+
+#include <rst/meta/algorithm.h>
+
+
+namespace rst::ecs
+{
+    runtime_view::runtime_view(
+        std::vector<detail::base_reg_pool_type*> pools, std::vector<detail::base_reg_pool_type*> excluded_pools )
+        : pools_{ std::move( pools ) }
+        , excluded_pools_{ [&excluded_pools]
+        {
+            std::erase( excluded_pools, nullptr );
+            return std::move( excluded_pools );
+        }( ) }
+    {
+        // a component nobody has empties the view, there is nothing to walk
+        if ( std::ranges::find( pools_, nullptr ) == pools_.end( ) )
+        {
+            pivot_ptr_ = meta::find_smallest<detail::base_reg_pool_type>( pools_ );
+        }
+    }
+
+
+    auto runtime_view::contains( entity_type const entity ) const noexcept -> bool
+    {
+        return pivot_ptr_ != nullptr &&
+               std::ranges::all_of( pools_, [entity]( auto const* pool ) { return pool->has( entity ); } ) &&
+               not excludes( entity );
+    }
+
+
+    auto runtime_view::get( entity_type const entity, std::size_t const slot ) const noexcept -> void*
+    {
+        detail::base_reg_pool_type* const pool = pools_[slot];
+        if ( pool == nullptr )
+        {
+            return nullptr;
+        }
+        std::size_t const pos = pool->position( entity );
+        return pos != detail::base_reg_pool_type::npos ? pool->erased_elements( pos ).data : nullptr;
+    }
+
+
+    auto runtime_view::component_count( ) const noexcept -> std::size_t
+    {
+        return pools_.size( );
+    }
+
+
+    auto runtime_view::size_hint( ) const noexcept -> std::size_t
+    {
+        return pivot_ptr_ != nullptr ? pivot_ptr_->size( ) : 0U;
+    }
+
+
+    auto runtime_view::begin( ) const noexcept -> iterator
+    {
+        return iterator{ *this, 0U };
+    }
+
+
+    auto runtime_view::end( ) const noexcept -> iterator
+    {
+        return iterator{ *this, size_hint( ) };
+    }
+
+
+    auto runtime_view::excludes( entity_type const entity ) const noexcept -> bool
+    {
+        return std::ranges::any_of( excluded_pools_, [entity]( auto const* pool ) { return pool->has( entity ); } );
+    }
+
+
+    auto runtime_view::next_match( std::size_t pos ) const noexcept -> std::size_t
+    {
+        std::size_t const size = size_hint( );
+        while ( pos < size && not contains( pivot_ptr_->packed( )[pos] ) ) { ++pos; }
+        return pos;
+    }
+
+
+    auto runtime_view::next_run(
+        std::size_t const pos, std::span<detail::base_reg_pool_type::erased_run> const runs,
+        std::span<std::span<entity_type const>> const packed ) const noexcept -> std::size_t
+    {
+        std::span<entity_type const> const pivot = pivot_ptr_->packed( );
+        if ( excludes( pivot[pos] ) )
+        {
+            return 0U;
+        }
+
+        // 1. locate the entity in every pool, tombstones are in none of them
+        std::size_t limit = pivot.size( ) - pos;
+        for ( std::size_t slot = 0U; slot < pools_.size( ); ++slot )
+        {
+            std::size_t const start = pools_[slot]->position( pivot[pos] );
+            if ( start == detail::base_reg_pool_type::npos )
+            {
+                return 0U;
+            }
+            runs[slot]   = pools_[slot]->erased_elements( start );
+            packed[slot] = pools_[slot]->packed( ).subspan( start );
+            limit        = std::min( limit, runs[slot].length );
+        }
+
+        // 2. extend the run while every pool holds the same entities in the same order, in one block
+        std::size_t length{ 1U };
+        while ( length < limit && pivot[pos + length] != detail::base_reg_pool_type::tombstone &&
+                std::ranges::all_of( packed, [entity = pivot[pos + length], length]( auto const pool_packed )
+                {
+                    return pool_packed[length] == entity;
+                } ) &&
+                not excludes( pivot[pos + length] ) )
+        {
+            ++length;
+        }
+        return length;
+    }
+
+
+    runtime_view::iterator::iterator( runtime_view const& view, std::size_t const pos ) noexcept
+        : view_ptr_{ &view }
+        , pos_{ view.next_match( pos ) } { }
+
+
+    auto runtime_view::iterator::operator*( ) const noexcept -> entity_type
+    {
+        return view_ptr_->pivot_ptr_->packed( )[pos_];
+    }
+
+
+    auto runtime_view::iterator::operator++( ) noexcept -> iterator&
+    {
+        pos_ = view_ptr_->next_match( pos_ + 1U );
+        return *this;
+    }
+
+
+    auto runtime_view::iterator::operator++( int ) noexcept -> iterator
+    {
+        iterator temp = *this;
+        ++( *this );
+        return temp;
+    }
+}
@@ -30,7 +30,7 @@ namespace rst::service
 
     auto sdl_renderer_service::render( pelt const& texture, glm::vec2 const pos, glm::vec4 const& src ) noexcept -> void
     {
-        render_queue_.insert(
+        render_queue_.push_back(
             internal::request{
                 .texture = &texture,
                 .dst = glm::vec4{ pos, texture.dimensions( ) },
@@ -42,7 +42,7 @@ namespace rst::service
 
     auto sdl_renderer_service::render( pelt const& texture, glm::vec4 const& dst, glm::vec4 const& src ) noexcept -> void
     {
-        render_queue_.insert(
+        render_queue_.push_back(
             internal::request{
                 .texture = &texture,
                 .dst = dst,
@@ -75,7 +75,11 @@ namespace rst::service
         // 1. clear the screen
         renderer_.clear( clear_color_ );
 
-        // 2. render all queued requests
+        // 2. render all queued requests, by z order and then by submission
+        if ( not std::ranges::is_sorted( render_queue_, internal::request_comparator{ } ) )
+        {
+            std::ranges::stable_sort( render_queue_, internal::request_comparator{ } );
+        }
         for ( auto const& request : render_queue_ )
         {
             renderer_.render_pelt_ex( *request.texture, request.dst, request.src );
@@ -0,0 +1,32 @@
+#include <rst/__core/__ecs/signature_table.h>
+
+
+namespace rst::ecs::detail
+{
+    auto signature_table::reserve_components( std::size_t const component_count ) -> void
+    {
+        std::size_t const width = std::max( ( component_count + bits_per_word - 1U ) / bits_per_word, std::size_t{ 1U } );
+        if ( width <= row_width_ )
+        {
+            return;
+        }
+
+        // re-lay the rows at the new width, back to front so that the copy can happen in place
+        std::size_t const rows = words_.size( ) / row_width_;
+        words_.resize( rows * width, 0U );
+        for ( std::size_t row = rows; row-- > 0U; )
+        {
+            for ( std::size_t word = width; word-- > 0U; )
+            {
+                words_[row * width + word] = word < row_width_ ? words_[row * row_width_ + word] : 0U;
+            }
+        }
+        row_width_ = width;
+    }
+
+
+    auto signature_table::clear( ) noexcept -> void
+    {
+        std::ranges::fill( words_, 0U );
+    }
+}
@@ -0,0 +1,127 @@
+#include <rst/__core/__ecs/snapshot.h>
+
+#include <rst/diagnostic.h>
+
+
+namespace rst::ecs
+{
+    // +--------------------------------+
+    // | MEMORY STREAMS                 |
+    // +--------------------------------+
+    memory_snapshot_output::memory_snapshot_output( std::vector<std::byte>& buffer ) noexcept
+        : buffer_ref_{ buffer } { }
+
+
+    auto memory_snapshot_output::write( std::span<std::byte const> const bytes ) -> void
+    {
+        buffer_ref_.insert( buffer_ref_.end( ), bytes.begin( ), bytes.end( ) );
+    }
+
+
+    memory_snapshot_input::memory_snapshot_input( std::span<std::byte const> const buffer ) noexcept
+        : buffer_{ buffer } { }
+
+
+    auto memory_snapshot_input::read( std::span<std::byte> const bytes ) noexcept -> bool
+    {
+        std::span<std::byte const> const source = take( bytes.size( ) );
+        if ( source.size( ) != bytes.size( ) )
+        {
+            return false;
+        }
+        std::ranges::copy( source, bytes.begin( ) );
+        return true;
+    }
+
+
+    auto memory_snapshot_input::skip( std::size_t const count ) noexcept -> bool
+    {
+        return take( count ).size( ) == count;
+    }
+
+
+    auto memory_snapshot_input::take( std::size_t const count ) noexcept -> std::span<std::byte const>
+    {
+        if ( count > buffer_.size( ) - cursor_ )
+        {
+            cursor_ = buffer_.size( );
+            return { };
+        }
+        return buffer_.subspan( std::exchange( cursor_, cursor_ + count ), count );
+    }
+
+
+    auto memory_snapshot_input::remaining( ) const noexcept -> std::size_t
+    {
+        return buffer_.size( ) - cursor_;
+    }
+
+
+    // +--------------------------------+
+    // | FILE STREAMS                   |
+    // +--------------------------------+
+    file_snapshot_output::file_snapshot_output( std::filesystem::path const& path )
+        : stream_{ path, std::ios::out | std::ios::binary | std::ios::trunc }
+    {
+        if ( not stream_.is_open( ) )
+        {
+            alert( "file_snapshot_output: could not open '{}' for writing!", path.string( ) );
+        }
+    }
+
+
+    auto file_snapshot_output::good( ) const noexcept -> bool
+    {
+        return stream_.is_open( ) && stream_.good( );
+    }
+
+
+    auto file_snapshot_output::write( std::span<std::byte const> const bytes ) -> void
+    {
+        stream_.write( reinterpret_cast<char const*>( bytes.data( ) ), static_cast<std::streamsize>( bytes.size( ) ) );
+    }
+
+
+    file_snapshot_input::file_snapshot_input( std::filesystem::path const& path )
+        : stream_{ path, std::ios::in | std::ios::binary }
+    {
+        if ( not stream_.is_open( ) )
+        {
+            alert( "file_snapshot_input: could not open '{}' for reading!", path.string( ) );
+            return;
+        }
+
+        std::error_code error{};
+        remaining_ = static_cast<std::size_t>( std::filesystem::file_size( path, error ) );
+        if ( error ) { remaining_ = 0U; }
+    }
+
+
+    auto file_snapshot_input::good( ) const noexcept -> bool
+    {
+        return stream_.is_open( ) && stream_.good( );
+    }
+
+
+    auto file_snapshot_input::read( std::span<std::byte> const bytes ) -> bool
+    {
+        stream_.read( reinterpret_cast<char*>( bytes.data( ) ), static_cast<std::streamsize>( bytes.size( ) ) );
+        remaining_ -= std::min( remaining_, bytes.size( ) );
+        return stream_.good( );
+    }
+
+
+    auto file_snapshot_input::skip( std::size_t const count ) -> bool
+    {
+        // seeking past the end succeeds, the read that follows is the one to fail
+        stream_.seekg( static_cast<std::streamoff>( count ), std::ios::cur );
+        remaining_ -= std::min( remaining_, count );
+        return stream_.good( );
+    }
+
+
+    auto file_snapshot_input::remaining( ) const noexcept -> std::size_t
+    {
+        return remaining_;
+    }
+}
@@ -0,0 +1,137 @@
+#include <rst/__core/__ecs/staging_area.h>
+
+#include <rst/diagnostic.h>
+
+
+namespace rst::ecs
+{
+    namespace
+    {
+        std::atomic<uint64_t> next_area_id{ 0U };
+
+        // ids of the areas alive, ascending. Read when a thread claims a slot, to drop the slots of dead areas
+        std::mutex live_areas_mutex{};
+        std::vector<uint64_t> live_areas{};
+
+        // the slot the calling thread claimed in each area it wrote to, a handful at most
+        thread_local std::vector<std::pair<uint64_t, std::size_t>> claimed_slots{};
+
+        // the areas the calling thread has a writer open on
+        thread_local std::vector<uint64_t> open_writers{};
+    }
+
+
+    auto staging_area::default_slot_count( ) noexcept -> std::size_t
+    {
+        return std::max( std::thread::hardware_concurrency( ), 1U ) + 4U;
+    }
+
+
+    staging_area::staging_area( std::size_t const slot_count )
+        : id_{ next_area_id.fetch_add( 1U, std::memory_order_relaxed ) }
+    {
+        slots_.resize( std::max( slot_count, std::size_t{ 1U } ) );
+        std::ranges::generate( slots_, [] { return std::make_unique<slot>( ); } );
+
+        // the id was taken before the lock, a later area may have registered first
+        std::lock_guard lock{ live_areas_mutex };
+        live_areas.insert( std::ranges::lower_bound( live_areas, id_ ), id_ );
+    }
+
+
+    staging_area::~staging_area( ) noexcept
+    {
+        std::lock_guard lock{ live_areas_mutex };
+        std::erase( live_areas, id_ );
+    }
+
+
+    auto staging_area::write( ) -> writer
+    {
+        ensure( std::ranges::find( open_writers, id_ ) == open_writers.end( ),
+                "staging_area::write: the calling thread already has a writer open on this area!" );
+
+        slot& owned = slot_of_current_thread( );
+        return writer{ id_, owned.mutex, owned.commands, pending_ };
+    }
+
+
+    auto staging_area::merge( registry& registry ) -> void
+    {
+        if ( not pending_.load( std::memory_order_relaxed ) || not pending_.exchange( false, std::memory_order_acquire ) )
+        {
+            return;
+        }
+
+        // a writer committing after the exchange raises the flag again, what it wrote is merged now or next time.
+        // Slots with a writer open are left for the next merge rather than waited for
+        bool skipped{ false };
+        std::size_t const claimed = std::min( claimed_slots_.load( std::memory_order_acquire ), slots_.size( ) );
+        for ( std::size_t i = 0U; i < claimed; ++i )
+        {
+            std::unique_lock lock{ slots_[i]->mutex, std::try_to_lock };
+            if ( not lock.owns_lock( ) )
+            {
+                skipped = true;
+                continue;
+            }
+            merged_.append( slots_[i]->commands );
+        }
+        if ( skipped )
+        {
+            pending_.store( true, std::memory_order_relaxed );
+        }
+        merged_.playback( registry );
+    }
+
+
+    auto staging_area::pending( ) const noexcept -> bool
+    {
+        return pending_.load( std::memory_order_relaxed );
+    }
+
+
+    auto staging_area::slot_of_current_thread( ) -> slot&
+    {
+        auto const it = std::ranges::find( claimed_slots, id_, &std::pair<uint64_t, std::size_t>::first );
+        if ( it != claimed_slots.end( ) )
+        {
+            return *slots_[it->second];
+        }
+
+        // first write of this thread to this area, forget the areas destroyed since the last one
+        {
+            std::lock_guard lock{ live_areas_mutex };
+            std::erase_if( claimed_slots, []( std::pair<uint64_t, std::size_t> const& claimed )
+                           {
+                               return not std::ranges::binary_search( live_areas, claimed.first );
+                           } );
+        }
+
+        // threads past the capacity share the slots, the slot mutex keeps them apart
+        std::size_t const index = claimed_slots_.fetch_add( 1U, std::memory_order_acq_rel ) % slots_.size( );
+        claimed_slots.emplace_back( id_, index );
+        return *slots_[index];
+    }
+
+
+    staging_area::writer::writer(
+        uint64_t const area_id, std::mutex& mutex, command_buffer& commands, std::atomic<bool>& pending )
+        : area_id_{ area_id }
+        , lock_{ mutex }
+        , commands_ref_{ commands }
+        , pending_ref_{ pending }
+    {
+        open_writers.push_back( area_id_ );
+    }
+
+
+    staging_area::writer::~writer( ) noexcept
+    {
+        std::erase( open_writers, area_id_ );
+        if ( not commands_ref_.empty( ) )
+        {
+            pending_ref_.store( true, std::memory_order_release );
+        }
+    }
+}
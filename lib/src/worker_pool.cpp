@@ -0,0 +1,163 @@
+#include <rst/data_type/worker_pool.h>
+
+
+namespace rst::thread
+{
+    // the pool the current thread works for, and its queue in that pool
+    static thread_local worker_pool const* current_pool_ptr{ nullptr };
+    static thread_local std::size_t current_queue{ 0U };
+
+
+    worker_pool::worker_pool( std::size_t const thread_count )
+    {
+        std::size_t const worker_count = std::max( thread_count, std::size_t{ 1U } ) - 1U;
+
+        queues_.reserve( worker_count + 1U );
+        for ( std::size_t i = 0U; i <= worker_count; ++i )
+        {
+            queues_.push_back( std::make_unique<task_queue>( ) );
+        }
+
+        workers_.reserve( worker_count );
+        for ( std::size_t i = 0U; i < worker_count; ++i )
+        {
+            workers_.emplace_back( &worker_pool::worker_loop, this, i + 1U );
+        }
+    }
+
+
+    worker_pool::~worker_pool( ) noexcept
+    {
+        {
+            std::lock_guard lock{ sleep_mutex_ };
+            stopping_ = true;
+        }
+        wake_cv_.notify_all( );
+
+        for ( std::thread& worker : workers_ )
+        {
+            worker.join( );
+        }
+    }
+
+
+    auto worker_pool::default_thread_count( ) noexcept -> std::size_t
+    {
+        return std::max( std::thread::hardware_concurrency( ), 1U );
+    }
+
+
+    auto worker_pool::thread_count( ) const noexcept -> std::size_t
+    {
+        return workers_.size( ) + 1U;
+    }
+
+
+    auto worker_pool::thread_index( ) const noexcept -> std::size_t
+    {
+        return current_queue_index( );
+    }
+
+
+    auto worker_pool::submit( task_group& group, task_type task ) -> void
+    {
+        group.pending_.fetch_add( 1U, std::memory_order_relaxed );
+
+        task_queue& queue = *queues_[current_queue_index( )];
+        {
+            std::lock_guard lock{ queue.mutex };
+            queue.tasks.push_back( { std::move( task ), &group } );
+        }
+
+        // the increment happens under the sleep mutex so that a worker checking queued_ before waiting cannot miss it
+        {
+            std::lock_guard lock{ sleep_mutex_ };
+            queued_.fetch_add( 1U, std::memory_order_release );
+        }
+        wake_cv_.notify_one( );
+    }
+
+
+    auto worker_pool::wait( task_group& group ) -> void
+    {
+        std::size_t const queue_index = current_queue_index( );
+        while ( not group.done( ) )
+        {
+            if ( not try_run_one( queue_index ) )
+            {
+                // the remaining tasks are running elsewhere
+                std::this_thread::yield( );
+            }
+        }
+    }
+
+
+    auto worker_pool::worker_loop( std::size_t const queue_index ) -> void
+    {
+        current_pool_ptr = this;
+        current_queue    = queue_index;
+
+        while ( true )
+        {
+            if ( try_run_one( queue_index ) )
+            {
+                continue;
+            }
+
+            std::unique_lock lock{ sleep_mutex_ };
+            wake_cv_.wait( lock, [this] { return stopping_ || queued_.load( std::memory_order_acquire ) > 0U; } );
+            if ( stopping_ )
+            {
+                return;
+            }
+        }
+    }
+
+
+    auto worker_pool::try_run_one( std::size_t const queue_index ) -> bool
+    {
+        // own queue first, newest task (still warm in cache), then steal the oldest task of the others. The shared
+        // queue is always drained oldest first, so a pool without workers runs tasks in submission order.
+        std::optional<task_entry> entry = try_pop( queue_index, queue_index != 0U );
+        for ( std::size_t offset = 1U; not entry.has_value( ) && offset < queues_.size( ); ++offset )
+        {
+            entry = try_pop( ( queue_index + offset ) % queues_.size( ), false );
+        }
+        if ( not entry.has_value( ) )
+        {
+            return false;
+        }
+
+        queued_.fetch_sub( 1U, std::memory_order_relaxed );
+        entry->task( );
+        entry->group->pending_.fetch_sub( 1U, std::memory_order_release );
+        return true;
+    }
+
+
+    auto worker_pool::try_pop( std::size_t const queue_index, bool const newest ) -> std::optional<task_entry>
+    {
+        task_queue& queue = *queues_[queue_index];
+        std::lock_guard lock{ queue.mutex };
+        if ( queue.tasks.empty( ) )
+        {
+            return std::nullopt;
+        }
+
+        if ( newest )
+        {
+            task_entry entry = std::move( queue.tasks.back( ) );
+            queue.tasks.pop_back( );
+            return entry;
+        }
+        task_entry entry = std::move( queue.tasks.front( ) );
+        queue.tasks.pop_front( );
+        return entry;
+    }
+
+
+    auto worker_pool::current_queue_index( ) const noexcept -> std::size_t
+    {
+        return current_pool_ptr == this ? current_queue : 0U;
+    }
+}